@@ -0,0 +1,95 @@
+"""Import and export of the random graph in text and binary formats."""
+
+import atexit
+import os
+import shutil
+import tempfile
+
+import jgrapht
+from jgrapht.io import exporters, importers
+
+from harness import benchmark
+
+
+_tmpdir = tempfile.mkdtemp(prefix="jgrapht-bench-")
+atexit.register(shutil.rmtree, _tmpdir, True)
+
+
+def _path(fixture, name):
+    return os.path.join(_tmpdir, "{}-{}".format(fixture.scale, name))
+
+
+@benchmark("io.write_csv_edgelist")
+def write_csv_edgelist(fixture):
+    g, filename = fixture.graph, _path(fixture, "edgelist.csv")
+    return lambda: exporters.write_csv(g, filename, format="edgelist", export_edge_weights=True)
+
+
+@benchmark("io.write_csv_edgelist_parallel")
+def write_csv_edgelist_parallel(fixture):
+    g, filename = fixture.graph, _path(fixture, "edgelist.csv")
+    return lambda: exporters.write_csv(
+        g, filename, format="edgelist", export_edge_weights=True, threads=0
+    )
+
+
+@benchmark("io.read_csv_edgelist")
+def read_csv_edgelist(fixture):
+    filename = _path(fixture, "edgelist.csv")
+    exporters.write_csv(fixture.graph, filename, format="edgelist", export_edge_weights=True)
+
+    def body():
+        g = jgrapht.create_graph(directed=False, weighted=True)
+        importers.read_csv(
+            g, filename, import_id_cb=int, format="edgelist", import_edge_weights=True
+        )
+
+    return body
+
+
+@benchmark("io.read_edgelist_stream")
+def read_edgelist_stream(fixture):
+    filename = _path(fixture, "edgelist.csv")
+    exporters.write_csv(fixture.graph, filename, format="edgelist", export_edge_weights=True)
+
+    def body():
+        with open(filename, "rb") as f:
+            importers.read_edgelist_stream(f, directed=False, weighted=True)
+
+    return body
+
+
+@benchmark("io.generate_json")
+def generate_json(fixture):
+    g = fixture.graph
+    return lambda: exporters.generate_json(g)
+
+
+@benchmark("io.parse_json")
+def parse_json(fixture):
+    text = exporters.generate_json(fixture.graph)
+
+    def body():
+        g = jgrapht.create_graph(directed=False, weighted=True)
+        importers.parse_json(g, text, import_id_cb=int)
+
+    return body
+
+
+@benchmark("io.generate_sparse6")
+def generate_sparse6(fixture):
+    g = fixture.graph
+    return lambda: exporters.generate_sparse6(g)
+
+
+@benchmark("io.write_binary")
+def write_binary(fixture):
+    g, filename = fixture.graph, _path(fixture, "graph.bin")
+    return lambda: exporters.write_binary(g, filename)
+
+
+@benchmark("io.read_binary")
+def read_binary(fixture):
+    filename = _path(fixture, "graph.bin")
+    exporters.write_binary(fixture.graph, filename)
+    return lambda: importers.read_binary(filename)
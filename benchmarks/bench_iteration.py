@@ -0,0 +1,97 @@
+"""Graph traversal from Python.
+
+The per-element benchmarks cross the language boundary once per vertex or edge, while
+the array benchmarks transfer the same data in a single call. Comparing both shows the
+cost of the boundary itself.
+"""
+
+from jgrapht import traversal
+
+from harness import benchmark
+
+
+@benchmark("iteration.vertices")
+def vertices(fixture):
+    g = fixture.graph
+
+    def body():
+        for _ in g.vertices():
+            pass
+
+    return body
+
+
+@benchmark("iteration.vertices_as_array")
+def vertices_as_array(fixture):
+    g = fixture.graph
+    return lambda: g.vertices_as_array()
+
+
+@benchmark("iteration.contains_vertex")
+def contains_vertex(fixture):
+    g, n = fixture.graph, fixture.n
+
+    def body():
+        for v in range(n):
+            g.contains_vertex(v)
+
+    return body
+
+
+@benchmark("iteration.edge_endpoints")
+def edge_endpoints(fixture):
+    g = fixture.graph
+
+    def body():
+        for e in g.edges():
+            g.edge_source(e)
+            g.edge_target(e)
+            g.get_edge_weight(e)
+
+    return body
+
+
+@benchmark("iteration.edge_tuples_as_arrays")
+def edge_tuples_as_arrays(fixture):
+    g = fixture.graph
+    return lambda: g.edge_tuples_as_arrays()
+
+
+@benchmark("iteration.edges_of")
+def edges_of(fixture):
+    g = fixture.graph
+
+    def body():
+        for v in g.vertices():
+            for _ in g.edges_of(v):
+                pass
+
+    return body
+
+
+@benchmark("iteration.csr_neighbors")
+def csr_neighbors(fixture):
+    csr = fixture.csr
+
+    def body():
+        for v in range(fixture.n):
+            csr.neighbors(v)
+
+    return body
+
+
+@benchmark("iteration.bfs_traversal")
+def bfs_traversal(fixture):
+    g = fixture.graph
+
+    def body():
+        for _ in traversal.bfs_traversal(g, 0):
+            pass
+
+    return body
+
+
+@benchmark("iteration.random_walks")
+def random_walks(fixture):
+    g = fixture.graph
+    return lambda: traversal.random_walks(g, walks_per_vertex=1, walk_length=20, seed=1)
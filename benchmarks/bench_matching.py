@@ -0,0 +1,29 @@
+"""Matchings on the random and the scale-free graph."""
+
+from jgrapht.algorithms import matching
+
+from harness import benchmark
+
+
+@benchmark("matching.greedy_max_cardinality")
+def greedy_max_cardinality(fixture):
+    g = fixture.graph
+    return lambda: matching.greedy_max_cardinality(g)
+
+
+@benchmark("matching.edmonds_max_cardinality", scales=("small", "medium"))
+def edmonds_max_cardinality(fixture):
+    g = fixture.scalefree
+    return lambda: matching.edmonds_max_cardinality(g)
+
+
+@benchmark("matching.greedy_max_weight")
+def greedy_max_weight(fixture):
+    g = fixture.graph
+    return lambda: matching.greedy_max_weight(g)
+
+
+@benchmark("matching.pathgrowing_max_weight")
+def pathgrowing_max_weight(fixture):
+    g = fixture.graph
+    return lambda: matching.pathgrowing_max_weight(g)
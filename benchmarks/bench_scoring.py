@@ -0,0 +1,29 @@
+"""Vertex scores."""
+
+from jgrapht.algorithms import scoring
+
+from harness import benchmark
+
+
+@benchmark("scoring.pagerank")
+def pagerank(fixture):
+    g = fixture.directed
+    return lambda: scoring.pagerank(g)
+
+
+@benchmark("scoring.betweenness_sampled")
+def betweenness_sampled(fixture):
+    g = fixture.graph
+    return lambda: scoring.betweenness_centrality(g, samples=50, seed=1, parallelism=0)
+
+
+@benchmark("scoring.betweenness", scales=("small",))
+def betweenness(fixture):
+    g = fixture.graph
+    return lambda: scoring.betweenness_centrality(g, parallelism=0)
+
+
+@benchmark("scoring.closeness", scales=("small",))
+def closeness(fixture):
+    g = fixture.graph
+    return lambda: scoring.closeness_centrality(g, parallelism=0)
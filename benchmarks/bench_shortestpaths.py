@@ -0,0 +1,36 @@
+"""Shortest paths, single source, between pairs and all pairs."""
+
+from jgrapht.algorithms import shortestpaths
+
+from harness import benchmark
+
+
+@benchmark("shortestpaths.dijkstra_singlesource")
+def dijkstra_singlesource(fixture):
+    g = fixture.graph
+    return lambda: shortestpaths.dijkstra(g, 0)
+
+
+@benchmark("shortestpaths.dijkstra_between")
+def dijkstra_between(fixture):
+    g, t = fixture.graph, fixture.n - 1
+    return lambda: shortestpaths.dijkstra(g, 0, t)
+
+
+@benchmark("shortestpaths.dijkstra_directed")
+def dijkstra_directed(fixture):
+    g = fixture.directed
+    return lambda: shortestpaths.dijkstra(g, 0)
+
+
+@benchmark("shortestpaths.bfs_multisource")
+def bfs_multisource(fixture):
+    g, sources = fixture.graph, range(0, fixture.n, 100)
+    return lambda: shortestpaths.bfs_multisource(g, sources, parallelism=0)
+
+
+@benchmark("shortestpaths.distance_matrix", scales=("small", "medium"))
+def distance_matrix(fixture):
+    # 100 rows keep the buffer small while still running one search per row
+    g, vertices = fixture.graph, list(range(0, fixture.n, fixture.n // 100))
+    return lambda: shortestpaths.distance_matrix(g, vertices, parallelism=0)
@@ -0,0 +1,86 @@
+"""Benchmark inputs at several scales.
+
+All graphs are generated with the generators of the library using fixed seeds, thus
+runs on different machines or revisions measure the same inputs. A fixture builds its
+graphs lazily and keeps them for all benchmarks of the same scale.
+"""
+
+import random
+
+import jgrapht
+import jgrapht.generators as generators
+
+
+SCALES = {
+    "small": (1000, 5000),
+    "medium": (10000, 50000),
+    "large": (100000, 500000),
+}
+
+SEED = 17
+
+
+class Fixture:
+    def __init__(self, scale):
+        self.scale = scale
+        self.n, self.m = SCALES[scale]
+        self._cache = {}
+
+    def _get(self, key, build):
+        if key not in self._cache:
+            self._cache[key] = build()
+        return self._cache[key]
+
+    @property
+    def graph(self):
+        """Undirected weighted random graph with n vertices and m edges."""
+        return self._get("graph", lambda: self._gnm(directed=False))
+
+    @property
+    def directed(self):
+        """Directed weighted random graph with n vertices and m edges."""
+        return self._get("directed", lambda: self._gnm(directed=True))
+
+    @property
+    def scalefree(self):
+        """Undirected preferential attachment graph with n vertices and about m edges."""
+
+        def build():
+            g = jgrapht.create_graph(directed=False, weighted=False)
+            d = max(1, self.m // self.n)
+            generators.barabasi_albert_graph(g, d + 1, d, self.n, seed=SEED)
+            return g
+
+        return self._get("scalefree", build)
+
+    @property
+    def sparse(self):
+        """The undirected random graph as an unmodifiable sparse graph."""
+        return self._get("sparse", lambda: jgrapht.as_sparse_graph(self.graph))
+
+    @property
+    def csr(self):
+        """The undirected random graph as a compact CSR graph."""
+        return self._get("csr", lambda: jgrapht.as_csr_graph(self.graph))
+
+    def _gnm(self, directed):
+        g = jgrapht.create_graph(
+            directed=directed,
+            allowing_self_loops=False,
+            allowing_multiple_edges=False,
+            weighted=True,
+        )
+        generators.gnm_random_graph(g, self.n, self.m, seed=SEED)
+        rng = random.Random(SEED)
+        edges = g.edges_as_array()
+        g.set_edge_weights(edges, [rng.uniform(1.0, 100.0) for _ in range(len(edges))])
+        return g
+
+
+_fixtures = {}
+
+
+def fixture(scale):
+    if scale not in _fixtures:
+        _fixtures[scale] = Fixture(scale)
+    return _fixtures[scale]
@@ -0,0 +1,132 @@
+"""Minimal benchmark harness.
+
+Benchmarks are plain functions registered with the :py:func:`benchmark` decorator. Each
+one receives a fixture for the requested scale, see :py:mod:`graphs`, and returns a
+callable which is the timed body. Building graphs and other preparation thus stays
+outside of the measurements.
+"""
+
+import fnmatch
+import json
+import platform
+import statistics
+import sys
+import time
+
+
+_registry = []
+
+
+class Benchmark:
+    def __init__(self, name, fn, scales):
+        self.name = name
+        self.fn = fn
+        self.scales = scales
+
+    @property
+    def group(self):
+        return self.name.split(".", 1)[0]
+
+
+def benchmark(name, scales=None):
+    """Register a benchmark.
+
+    :param name: a dotted name whose first part is the group, e.g. io.write_csv
+    :param scales: the scales supported, None for all of them
+    """
+
+    def decorator(fn):
+        _registry.append(Benchmark(name, fn, scales))
+        return fn
+
+    return decorator
+
+
+def select(patterns=None):
+    """Registered benchmarks whose name matches any of the glob patterns."""
+    if not patterns:
+        return list(_registry)
+    return [b for b in _registry if any(fnmatch.fnmatchcase(b.name, p) for p in patterns)]
+
+
+def _time(body, repeat, warmup):
+    for _ in range(warmup):
+        body()
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        body()
+        times.append(time.perf_counter() - start)
+    return times
+
+
+def run(benchmarks, scales, fixtures, repeat=5, warmup=1, log=None):
+    """Run benchmarks at several scales and return a list of result dictionaries."""
+    results = []
+    for scale in scales:
+        for b in benchmarks:
+            if b.scales is not None and scale not in b.scales:
+                continue
+            fixture = fixtures(scale)
+            body = b.fn(fixture)
+            times = _time(body, repeat, warmup)
+            result = {
+                "name": b.name,
+                "group": b.group,
+                "scale": scale,
+                "vertices": fixture.n,
+                "edges": fixture.m,
+                "repeat": repeat,
+                "times": times,
+                "min": min(times),
+                "median": statistics.median(times),
+                "mean": statistics.mean(times),
+            }
+            results.append(result)
+            if log is not None:
+                log(
+                    "{:<40} {:<8} min {:10.6f}s  median {:10.6f}s".format(
+                        b.name, scale, result["min"], result["median"]
+                    )
+                )
+    return results
+
+
+def report(results):
+    """Wrap results with information about the environment."""
+    try:
+        from jgrapht import __version__ as version
+    except ImportError:
+        version = None
+    return {
+        "python": sys.version.split()[0],
+        "implementation": platform.python_implementation(),
+        "platform": platform.platform(),
+        "machine": platform.machine(),
+        "jgrapht": version,
+        "timestamp": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+        "results": results,
+    }
+
+
+def compare(results, baseline, threshold):
+    """Compare the median times to a previous report.
+
+    :returns: a list of (name, scale, ratio) of the results slower than the baseline by more
+      than the threshold factor
+    """
+    previous = {(r["name"], r["scale"]): r for r in baseline["results"]}
+    regressions = []
+    for r in results:
+        old = previous.get((r["name"], r["scale"]))
+        if old is None or old["median"] <= 0:
+            continue
+        ratio = r["median"] / old["median"]
+        if ratio > threshold:
+            regressions.append((r["name"], r["scale"], ratio))
+    return regressions
+
+
+def dump(data, out):
+    json.dump(data, out, indent=2)
+    out.write("\n")
@@ -0,0 +1,95 @@
+"""Run the benchmark suite and report the results as JSON.
+
+Examples::
+
+    python benchmarks/run.py --scale small --output results.json
+    python benchmarks/run.py --filter "io.*" --filter "scoring.pagerank"
+    python benchmarks/run.py --baseline results.json --threshold 1.2
+
+With a baseline, the run fails with exit status 1 if the median time of any
+benchmark exceeds the median time of the baseline by more than the threshold factor.
+"""
+
+import argparse
+import importlib
+import json
+import sys
+
+import harness
+from graphs import SCALES, fixture
+
+
+MODULES = [
+    "bench_io",
+    "bench_iteration",
+    "bench_shortestpaths",
+    "bench_scoring",
+    "bench_matching",
+]
+
+
+def _parse_args(argv):
+    parser = argparse.ArgumentParser(description="Run the jgrapht benchmark suite.")
+    parser.add_argument(
+        "--scale",
+        action="append",
+        choices=sorted(SCALES),
+        help="scale to run, may be repeated (default: small and medium)",
+    )
+    parser.add_argument(
+        "--filter",
+        action="append",
+        metavar="PATTERN",
+        help="glob pattern on benchmark names, may be repeated",
+    )
+    parser.add_argument("--repeat", type=int, default=5, help="timed runs per benchmark")
+    parser.add_argument("--warmup", type=int, default=1, help="untimed runs per benchmark")
+    parser.add_argument("--output", metavar="FILE", help="write the JSON report to FILE")
+    parser.add_argument("--baseline", metavar="FILE", help="JSON report to compare with")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=1.25,
+        help="slowdown factor against the baseline reported as regression",
+    )
+    parser.add_argument("--list", action="store_true", help="list the benchmarks and exit")
+    return parser.parse_args(argv)
+
+
+def main(argv=None):
+    args = _parse_args(argv)
+    for name in MODULES:
+        importlib.import_module(name)
+    benchmarks = harness.select(args.filter)
+
+    if args.list:
+        for b in benchmarks:
+            print(b.name)
+        return 0
+
+    scales = args.scale or ["small", "medium"]
+    log = lambda line: print(line, file=sys.stderr)
+    results = harness.run(
+        benchmarks, scales, fixture, repeat=args.repeat, warmup=args.warmup, log=log
+    )
+    report = harness.report(results)
+
+    if args.output is None:
+        harness.dump(report, sys.stdout)
+    else:
+        with open(args.output, "w") as out:
+            harness.dump(report, out)
+
+    if args.baseline is not None:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = harness.compare(results, baseline, args.threshold)
+        for name, scale, ratio in regressions:
+            log("regression: {} ({}) is {:.2f}x slower".format(name, scale, ratio))
+        if regressions:
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -13,12 +13,17 @@ from .__version__ import __version__, __backend_version__
 from .__version__ import __author__, __author_email__, __license__
 from .__version__ import __copyright__
 
-# Create main thread and setup cleanup
+# Create the isolate and setup cleanup. Any other thread which calls
+# into the backend is attached to the isolate on its first call.
 from . import backend
 import atexit
+import os
 
 backend.jgrapht_isolate_create()
+if os.environ.get("JGRAPHT_BACKEND_STATS", "0") not in ("", "0"):
+    backend.jgrapht_stats_set_enabled(True)
 del backend
+del os
 
 def _module_cleanup_function():
     from . import backend
@@ -32,8 +37,18 @@ del atexit
 from ._internals._graphs import (
     create_graph,
     create_sparse_graph,
+    create_sparse_graph_from_arrays,
     as_sparse_graph,
+    as_csr_graph,
 ) 
+from ._internals._stats import (
+    backend_stats,
+    enable_backend_stats,
+)
+from ._internals._wrappers import (
+    handle_arena,
+    pooled_iterator,
+)
 from . import types
 
 
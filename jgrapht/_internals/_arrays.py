@@ -0,0 +1,46 @@
+from array import array
+
+
+def _int_array(size):
+    """Create a zero filled array of integers."""
+    return array("i", [0]) * size
+
+
+def _double_array(size):
+    """Create a zero filled array of doubles."""
+    return array("d", [0.0]) * size
+
+
+def _long_array(size):
+    """Create a zero filled array of 64-bit integers."""
+    return array("q", [0]) * size
+
+
+def _is_array_of(obj, format):
+    """Check whether an object exposes a contiguous buffer with a specific item format."""
+    try:
+        view = memoryview(obj)
+    except TypeError:
+        return False
+    with view:
+        return view.c_contiguous and view.format.lstrip("@=") == format
+
+
+def _as_int_array(values):
+    """Get any iterable of integers as an object which can be passed to the backend as an
+    int array. Objects such as :py:class:`array.array` or numpy arrays which already provide
+    a buffer with the correct type are returned without copying.
+    """
+    if _is_array_of(values, "i"):
+        return values
+    return array("i", values)
+
+
+def _as_double_array(values):
+    """Get any iterable of floats as an object which can be passed to the backend as a
+    double array. Objects such as :py:class:`array.array` or numpy arrays which already
+    provide a buffer with the correct type are returned without copying.
+    """
+    if _is_array_of(values, "d"):
+        return values
+    return array("d", values)
@@ -1,5 +1,13 @@
 from .. import backend
-from ._wrappers import _HandleWrapper
+from ._wrappers import _HandleWrapper, _NativeHandleWrapper
+from ._arrays import (
+    _int_array,
+    _double_array,
+    _as_int_array,
+    _as_double_array,
+)
+
+from collections.abc import Mapping
 
 
 class _JGraphTAttributeStore(_HandleWrapper):
@@ -15,6 +23,36 @@ class _JGraphTAttributeStore(_HandleWrapper):
             self._handle, element, key, value
         )
 
+    def put_column(self, key, elements, values, type="string"):
+        """Put the same attribute for many elements using a single backend call. The
+        backend still stores the attributes in the isolate one element at a time.
+
+        :param key: the attribute key
+        :param elements: the elements, as an array or any iterable of integers
+        :param values: the attribute value of each element
+        :param type: one of "string", "int", "double" or "boolean"
+        """
+        elements = _as_int_array(elements)
+        if type == "string":
+            encoded = "".join(str(v) + "\0" for v in values).encode("utf-8")
+            backend.jgrapht_attributes_store_put_string_column(
+                self._handle, elements, key, encoded
+            )
+        elif type == "int":
+            backend.jgrapht_attributes_store_put_int_column(
+                self._handle, elements, key, _as_int_array(values)
+            )
+        elif type == "double":
+            backend.jgrapht_attributes_store_put_double_column(
+                self._handle, elements, key, _as_double_array(values)
+            )
+        elif type == "boolean":
+            backend.jgrapht_attributes_store_put_boolean_column(
+                self._handle, elements, key, _as_int_array(bool(v) for v in values)
+            )
+        else:
+            raise ValueError("Unknown attribute type {}".format(type))
+
     def remove(self, element, key):
         backend.jgrapht_attributes_store_remove_attribute(
             self._handle, element, key
@@ -46,3 +84,69 @@ class _JGraphTAttributesRegistry(_HandleWrapper):
 
     def __repr__(self):
         return "_JGraphTAttributesRegistry(%r)" % self._handle
+
+
+class _JGraphTAttributeColumns(_NativeHandleWrapper, Mapping):
+    """Attribute columns. Used by importers to collect attributes in the backend
+    without calling back into Python for each attribute.
+
+    The mapping has one entry per attribute key. The value of each entry is a tuple
+    with an array of element identifiers and the values of the attribute for these
+    elements. Values are an integer array if all of them are integers, a double array
+    if all of them are numbers and a list of strings otherwise.
+    """
+
+    def __init__(self, handle=None, **kwargs):
+        if handle is None:
+            handle = backend.jgrapht_attributes_columns_create()
+        super().__init__(handle=handle, **kwargs)
+
+    def _callback_ptr(self, edges):
+        # binds the columns to the imports of the current thread
+        return backend.jgrapht_attributes_columns_bind(self._handle, edges)
+
+    def _column_of(self, key):
+        for column in range(backend.jgrapht_attributes_columns_count(self._handle)):
+            if backend.jgrapht_attributes_columns_key(self._handle, column) == key:
+                return column
+        raise KeyError(key)
+
+    def __getitem__(self, key):
+        column = self._column_of(key)
+        size, type, num_bytes = backend.jgrapht_attributes_columns_info(
+            self._handle, column
+        )
+        ids = _int_array(size)
+        backend.jgrapht_attributes_columns_ids(self._handle, column, ids)
+
+        if type == backend.ATTRIBUTE_COLUMN_INT:
+            values = _int_array(size)
+            backend.jgrapht_attributes_columns_int_values(self._handle, column, values)
+        elif type == backend.ATTRIBUTE_COLUMN_DOUBLE:
+            values = _double_array(size)
+            backend.jgrapht_attributes_columns_double_values(
+                self._handle, column, values
+            )
+        else:
+            buffer = bytearray(num_bytes)
+            backend.jgrapht_attributes_columns_string_values(
+                self._handle, column, buffer
+            )
+            # values are separated by a terminating zero
+            values = buffer.decode("utf-8").split("\0")[:-1] if size > 0 else []
+
+        return ids, values
+
+    def __iter__(self):
+        count = backend.jgrapht_attributes_columns_count(self._handle)
+        for column in range(count):
+            yield backend.jgrapht_attributes_columns_key(self._handle, column)
+
+    def __len__(self):
+        return backend.jgrapht_attributes_columns_count(self._handle)
+
+    def _destroy(self):
+        backend.jgrapht_attributes_columns_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTAttributeColumns(%r)" % self._handle
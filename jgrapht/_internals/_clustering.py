@@ -22,4 +22,39 @@ class _JGraphTClustering(_HandleWrapper, Clustering):
         return _JGraphTIntegerIterator(res)
 
     def __repr__(self):
-        return "_JGraphTClustering(%r)" % self._handle
\ No newline at end of file
+        return "_JGraphTClustering(%r)" % self._handle
+
+
+class _JGraphTDenseClustering(Clustering):
+    """A vertex clustering stored as one label per vertex. The label of vertices[i]
+    is labels[i] and labels are numbered from zero.
+    """
+
+    def __init__(self, vertices, labels, count):
+        self._vertices = vertices
+        self._labels = labels
+        self._count = count
+        self._clusters = None
+
+    @property
+    def vertices(self):
+        """The vertices as an array, in the order of the labels."""
+        return self._vertices
+
+    @property
+    def labels(self):
+        """The cluster of each vertex as an array."""
+        return self._labels
+
+    def number_of_clusters(self):
+        return self._count
+
+    def ith_cluster(self, i):
+        if self._clusters is None:
+            self._clusters = [[] for _ in range(self._count)]
+            for v, label in zip(self._vertices, self._labels):
+                self._clusters[label].append(v)
+        return iter(self._clusters[i])
+
+    def __repr__(self):
+        return "_JGraphTDenseClustering(%d clusters)" % self._count
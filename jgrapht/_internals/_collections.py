@@ -2,14 +2,20 @@ from .. import backend
 
 from ._wrappers import (
     _HandleWrapper,
+    _NativeHandleWrapper,
     _JGraphTObjectIterator,
     _JGraphTIntegerIterator,
 )
+from ._arrays import (
+    _int_array,
+    _double_array,
+)
 
 from collections.abc import (
     MutableSet,
     Collection,
     MutableMapping,
+    Iterator,
 )
 
 
@@ -64,6 +70,34 @@ class _JGraphTIntegerSetIterator(_JGraphTObjectIterator):
     def __repr__(self):
         return "_JGraphTIntegerSetIterator(%r)" % self._handle
 
+
+class _JGraphTEnumerationBatchIterator(_NativeHandleWrapper, Iterator):
+    """An iterator over batches of results of a native enumeration. Each batch is a
+    tuple (members, offsets) where the members of result i are 
+    members[offsets[i]:offsets[i+1]].
+    """
+
+    def __init__(self, handle, batch_size, **kwargs):
+        super().__init__(handle=handle, **kwargs)
+        self._batch_size = batch_size
+
+    def __next__(self):
+        count, size = backend.jgrapht_enumeration_next_batch(
+            self._handle, self._batch_size
+        )
+        if count == 0:
+            raise StopIteration()
+        members = _int_array(size)
+        offsets = _int_array(count + 1)
+        backend.jgrapht_enumeration_batch_copy(self._handle, members, offsets)
+        return members, offsets
+
+    def _destroy(self):
+        backend.jgrapht_enumeration_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTEnumerationBatchIterator(%r)" % self._handle
+
     
 class _JGraphTIntegerList(_HandleWrapper, Collection):
     """JGraphT Integer List"""
@@ -181,6 +215,19 @@ class _JGraphTIntegerDoubleMap(_HandleWrapper, MutableMapping):
     def clear(self):
         backend.jgrapht_map_clear(self._handle)
 
+    def to_arrays(self):
+        """Copy the whole map into a pair of arrays using a single backend call.
+
+        :returns: a tuple (keys, values) of arrays where values[i] is the value of keys[i]
+        """
+        size = backend.jgrapht_map_size(self._handle)
+        keys = _int_array(size)
+        values = _double_array(size)
+        count = backend.jgrapht_map_int_double_to_arrays(self._handle, keys, values)
+        del keys[count:]
+        del values[count:]
+        return keys, values
+
     def __repr__(self):
         return "_JGraphTIntegerDoubleMap(%r)" % self._handle
 
@@ -250,6 +297,19 @@ class _JGraphTIntegerIntegerMap(_HandleWrapper, MutableMapping):
     def clear(self):
         backend.jgrapht_map_clear(self._handle)
 
+    def to_arrays(self):
+        """Copy the whole map into a pair of arrays using a single backend call.
+
+        :returns: a tuple (keys, values) of arrays where values[i] is the value of keys[i]
+        """
+        size = backend.jgrapht_map_size(self._handle)
+        keys = _int_array(size)
+        values = _int_array(size)
+        count = backend.jgrapht_map_int_int_to_arrays(self._handle, keys, values)
+        del keys[count:]
+        del values[count:]
+        return keys, values
+
     def __repr__(self):
         return "_JGraphTIntegerIntegerMap(%r)" % self._handle
 
@@ -1,8 +1,17 @@
+from .. import backend
 from ..types import (
     Cut, 
     Flow,
 )
 
+from ._wrappers import _NativeHandleWrapper
+from ._arrays import (
+    _int_array,
+    _double_array,
+    _as_int_array,
+    _as_double_array,
+)
+
 from ._collections import (
     _JGraphTIntegerSet,
     _JGraphTIntegerDoubleMap,
@@ -95,4 +104,71 @@ class _JGraphTFlow(_JGraphTIntegerDoubleMap, Flow):
         return self._value
 
     def __repr__(self):
-        return "_JGraphTFlow(%r)" % self._handle
\ No newline at end of file
+        return "_JGraphTFlow(%r)" % self._handle
+
+
+class _JGraphTMaxFlowSolver(_NativeHandleWrapper):
+    """A maximum flow solver whose residual network is built once by the native code
+    and reused by every query."""
+
+    def __init__(self, handle, number_of_vertices, **kwargs):
+        super().__init__(handle=handle, **kwargs)
+        self._vertices = _int_array(number_of_vertices)
+        backend.jgrapht_maxflow_solver_vertices(self._handle, self._vertices)
+
+    @property
+    def vertices(self):
+        """Vertices of the network, in the order of the bits of the cut bitmaps."""
+        return self._vertices
+
+    @property
+    def words_per_cut(self):
+        """Number of 32-bit words of each row of a cut bitmap."""
+        return (len(self._vertices) + 31) // 32
+
+    def set_capacities(self, edges, capacities):
+        """Change the capacities of some edges for all following queries."""
+        backend.jgrapht_maxflow_solver_set_capacities(
+            self._handle, _as_int_array(edges), _as_double_array(capacities)
+        )
+
+    def max_flow_values(self, sources, sinks, cuts=False, threads=1):
+        """Compute the maximum flow value of each pair (sources[i], sinks[i]).
+
+        :param sources: the source of each query
+        :param sinks: the sink of each query
+        :param cuts: whether to also compute the source side of a minimum cut of each query
+        :param threads: number of threads, zero or negative for the number of processors
+        :returns: an array of flow values, or a tuple (values, bitmap) if cuts is True 
+          where row i of the bitmap has :py:attr:`words_per_cut` words and bit k is set 
+          for the k-th vertex of :py:attr:`vertices` if it belongs to the source side
+        """
+        sources = _as_int_array(sources)
+        sinks = _as_int_array(sinks)
+        values = _double_array(len(sources))
+        bitmap = _int_array(len(sources) * self.words_per_cut) if cuts else None
+        backend.jgrapht_maxflow_solver_exec_batch(
+            self._handle, sources, sinks, threads, values, bitmap
+        )
+        if cuts:
+            return values, bitmap
+        return values
+
+    def max_flow_value(self, source, sink):
+        """Compute the maximum flow value from a source to a sink."""
+        return self.max_flow_values([source], [sink])[0]
+
+    def source_partition(self, bitmap, i=0):
+        """Decode the source side of the cut of query i from a cut bitmap as a set."""
+        row = self.words_per_cut * i
+        return set(
+            v
+            for k, v in enumerate(self._vertices)
+            if (bitmap[row + k // 32] >> (k % 32)) & 1
+        )
+
+    def _destroy(self):
+        backend.jgrapht_maxflow_solver_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTMaxFlowSolver(%r)" % self._handle
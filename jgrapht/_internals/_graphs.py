@@ -8,6 +8,13 @@ from collections.abc import (
 )
 from ._wrappers import _HandleWrapper
 from ._collections import _JGraphTIntegerIterator
+from ._arrays import (
+    _int_array,
+    _double_array,
+    _as_int_array,
+    _as_double_array,
+)
+from array import array
 
 
 class _JGraphTGraph(_HandleWrapper, Graph):
@@ -55,6 +62,17 @@ class _JGraphTGraph(_HandleWrapper, Graph):
     def add_vertex(self, vertex):
         return backend.jgrapht_graph_add_given_vertex(self._handle, vertex)
 
+    def add_vertices_from(self, vertices):
+        vertices = _as_int_array(vertices)
+        added = _int_array(len(vertices))
+        backend.jgrapht_graph_add_given_vertices(self._handle, vertices, added)
+        return [bool(x) for x in added]
+
+    def create_vertices(self, count):
+        vertices = _int_array(count)
+        backend.jgrapht_graph_add_vertices(self._handle, vertices)
+        return vertices
+
     def remove_vertex(self, v):
         backend.jgrapht_graph_remove_vertex(self._handle, v)
 
@@ -73,9 +91,33 @@ class _JGraphTGraph(_HandleWrapper, Graph):
             self.set_edge_weight(edge, weight)
         return added
 
+    def create_edges_from(self, edges):
+        edges = list(edges)
+        # a weight of None means the default weight
+        with_weights = sum(1 for edge in edges if len(edge) > 2 and edge[2] is not None)
+        if 0 < with_weights < len(edges):
+            # mixed tuples, only some of the edges get a weight
+            return super().create_edges_from(edges)
+        sources = array("i", (edge[0] for edge in edges))
+        targets = array("i", (edge[1] for edge in edges))
+        weights = array("d", (edge[2] for edge in edges)) if with_weights > 0 else None
+        return list(self.create_edges_from_arrays(sources, targets, weights))
+
+    def create_edges_from_arrays(self, sources, targets, weights=None):
+        sources = _as_int_array(sources)
+        targets = _as_int_array(targets)
+        if weights is not None:
+            weights = _as_double_array(weights)
+        edges = _int_array(len(sources))
+        backend.jgrapht_graph_add_edges(self._handle, sources, targets, weights, edges)
+        return edges
+
     def remove_edge(self, e):
         return backend.jgrapht_graph_remove_edge(self._handle, e)
 
+    def remove_edges_from(self, edges):
+        return backend.jgrapht_graph_remove_edges(self._handle, _as_int_array(edges))
+
     def contains_edge(self, e):
         return backend.jgrapht_graph_contains_edge(self._handle, e)
 
@@ -103,6 +145,11 @@ class _JGraphTGraph(_HandleWrapper, Graph):
     def set_edge_weight(self, e, weight):
         backend.jgrapht_graph_set_edge_weight(self._handle, e, weight)
 
+    def set_edge_weights(self, edges, weights):
+        backend.jgrapht_graph_set_edge_weights(
+            self._handle, _as_int_array(edges), _as_double_array(weights)
+        )
+
     def number_of_vertices(self):
         return len(self.vertices())
 
@@ -119,6 +166,32 @@ class _JGraphTGraph(_HandleWrapper, Graph):
             self._edge_set = self._EdgeSet(self._handle)
         return self._edge_set
 
+    def vertices_as_array(self):
+        vertices = _int_array(backend.jgrapht_graph_vertices_count(self._handle))
+        count = backend.jgrapht_graph_vertices_array(self._handle, vertices)
+        del vertices[count:]
+        return vertices
+
+    def edges_as_array(self):
+        edges = _int_array(backend.jgrapht_graph_edges_count(self._handle))
+        count = backend.jgrapht_graph_edges_array(self._handle, edges)
+        del edges[count:]
+        return edges
+
+    def edge_tuples_as_arrays(self, edges=None):
+        if edges is None:
+            edges = self.edges_as_array()
+        else:
+            edges = _as_int_array(edges)
+        n = len(edges)
+        sources = _int_array(n)
+        targets = _int_array(n)
+        weights = _double_array(n)
+        backend.jgrapht_graph_edges_endpoints_array(
+            self._handle, edges, sources, targets, weights
+        )
+        return edges, sources, targets, weights
+
     def edges_between(self, u, v):
         res = backend.jgrapht_graph_create_between_eit(self._handle, u, v)
         return _JGraphTIntegerIterator(res)
@@ -183,6 +256,114 @@ class _JGraphTGraph(_HandleWrapper, Graph):
         return "_JGraphTGraph(%r)" % self._handle
 
 
+class _JGraphTCSRGraph(_JGraphTGraph):
+    """A compact graph backed by CSR arrays which are owned by Python.
+
+    Vertex v of the graph has its arcs at positions offsets[v] up to offsets[v+1] of 
+    the targets, edge ids and weights arrays. The arcs of each vertex are sorted by 
+    target. Vertices and edges are numbered from 0 and the ids of the graph they were 
+    copied from are kept in the original vertices and edges arrays.
+
+    The sparse graph in the isolate, which backs all other methods and the algorithms, 
+    is only built from the arrays when its handle is first needed.
+    """
+
+    # the handle may be built after the arena active at construction has been cleared
+    _in_arenas = False
+
+    def __init__(self, directed, offsets, targets, edge_ids, weights, original_vertices, original_edges, **kwargs):
+        _HandleWrapper.__init__(self, handle=None, **kwargs)
+        self._vertex_set = None
+        self._edge_set = None
+        self._type = GraphType(directed, True, True, weights is not None)
+        self._offsets = offsets
+        self._targets = targets
+        self._edge_ids = edge_ids
+        self._weights = weights
+        self._original_vertices = original_vertices
+        self._original_edges = original_edges
+
+    @property
+    def _handle(self):
+        if self._sparse_handle is None:
+            self._sparse_handle = backend.jgrapht_graph_sparse_create_from_csr(
+                self._type.directed, self._offsets, self._targets, self._edge_ids, self._weights
+            )
+        return self._sparse_handle
+
+    @_handle.setter
+    def _handle(self, handle):
+        self._sparse_handle = handle
+
+    def __del__(self):
+        if self._sparse_handle is not None and backend.jgrapht_isolate_is_attached():
+            backend.jgrapht_handles_destroy(self._sparse_handle)
+
+    def number_of_vertices(self):
+        return len(self._original_vertices)
+
+    def number_of_edges(self):
+        return len(self._original_edges)
+
+    @property
+    def offsets(self):
+        """Array with the position of the first arc of each vertex, with one extra entry 
+        holding the total number of arcs."""
+        return self._offsets
+
+    @property
+    def targets(self):
+        """Array with the target vertex of each arc."""
+        return self._targets
+
+    @property
+    def edge_ids(self):
+        """Array with the edge of each arc."""
+        return self._edge_ids
+
+    @property
+    def weights(self):
+        """Array with the weight of each arc or None if the graph is unweighted. The 
+        array is a copy, changing the weight of an edge does not update it."""
+        return self._weights
+
+    @property
+    def original_vertices(self):
+        """Array with the vertex of the original graph for each vertex."""
+        return self._original_vertices
+
+    @property
+    def original_edges(self):
+        """Array with the edge of the original graph for each edge."""
+        return self._original_edges
+
+    def neighbors(self, v):
+        """Get the (out-)neighbors of a vertex. 
+
+        :param v: the vertex
+        :returns: a view over the targets array, sorted and without copying 
+        """
+        return self._arcs_view(self._targets, v)
+
+    def neighbor_edges(self, v):
+        """Get the edges of the arcs returned by :py:meth:`neighbors`, without copying."""
+        return self._arcs_view(self._edge_ids, v)
+
+    def neighbor_weights(self, v):
+        """Get the weights of the arcs returned by :py:meth:`neighbors`, without copying."""
+        if self._weights is None:
+            raise ValueError("Graph is unweighted")
+        return self._arcs_view(self._weights, v)
+
+    def _arcs_view(self, values, v):
+        if v < 0 or v + 1 >= len(self._offsets):
+            raise IndexError("Vertex {} not in graph".format(v))
+        return memoryview(values)[self._offsets[v] : self._offsets[v + 1]]
+
+    def __repr__(self):
+        return "_JGraphTCSRGraph(%r)" % self._sparse_handle
+
+
 def create_graph(
     directed=True,
     allowing_self_loops=False,
@@ -232,15 +413,62 @@ def create_sparse_graph(num_of_vertices, edgelist, directed=True, weighted=True)
     :returns: a graph
     :rtype: :class:`jgrapht.types.Graph`
     """
-    e_list = backend.jgrapht_list_create()
+    sources = array("i")
+    targets = array("i")
+    weights = array("d") if weighted else None
     if weighted: 
         for u, v, w in edgelist: 
-            backend.jgrapht_list_edge_triple_add(e_list, u, v, w)
+            sources.append(u)
+            targets.append(v)
+            weights.append(w)
     else:
         for u, v in edgelist: 
-            backend.jgrapht_list_edge_pair_add(e_list, u, v)
+            sources.append(u)
+            targets.append(v)
+
+    return create_sparse_graph_from_arrays(
+        num_of_vertices, sources, targets, weights, directed=directed, weighted=weighted
+    )
+
+
+def create_sparse_graph_from_arrays(
+    num_of_vertices, sources, targets, weights=None, directed=True, weighted=True
+):
+    """Create a sparse graph from edge arrays.
+
+    This is the same as :py:meth:`create_sparse_graph` but with the edges given as 
+    parallel arrays, where edge i is (sources[i], targets[i], weights[i]). Arrays are 
+    read using the buffer protocol. Thus, if :py:class:`array.array` instances or 
+    numpy arrays of type int32 (float64 for the weights) are passed, they are handed 
+    to the backend without any copying and without a backend call per edge. Any other
+    iterable is first converted to an array. Note that the backend still passes the 
+    edges to the isolate one at a time, since the isolate creates sparse graphs only 
+    from an edge list.
+
+    Edge identifiers of the resulting graph follow the order of the arrays, starting
+    from 0.
+
+    :param num_of_vertices: number of vertices in the graph. Vertices always start from 0 
+      and increase continuously
+    :param sources: the source vertex of each edge
+    :param targets: the target vertex of each edge
+    :param weights: the weight of each edge. If None and the graph is weighted, all 
+      edges get a weight of 1.0
+    :param directed: whether the graph will be directed or undirected
+    :param weighted: whether the graph will be weighted or not
+    :returns: a graph
+    :rtype: :class:`jgrapht.types.Graph`
+    """
+    sources = _as_int_array(sources)
+    targets = _as_int_array(targets)
+    if weighted and weights is not None:
+        weights = _as_double_array(weights)
+    else:
+        weights = None
 
-    handle = backend.jgrapht_graph_sparse_create(directed, weighted, num_of_vertices, e_list)
+    handle = backend.jgrapht_graph_sparse_create_from_arrays(
+        directed, weighted, num_of_vertices, sources, targets, weights
+    )
 
     return _JGraphTGraph(handle)
 
@@ -263,12 +491,83 @@ def as_sparse_graph(graph):
     if len(graph.vertices()) == 0: 
         raise ValueError("Graph with no vertices")
 
-    max_vertex = max(graph.vertices())
+    max_vertex = max(graph.vertices_as_array())
 
-    if graph.type.weighted:
-        edgelist = [graph.edge_tuple(e) for e in graph.edges()]
-    else: 
-        edgelist = [graph.edge_tuple(e) for e in graph.edges()]
-    
-    return create_sparse_graph(max_vertex+1, edgelist, graph.type.directed, graph.type.weighted)
+    _, sources, targets, weights = graph.edge_tuples_as_arrays()
+
+    return create_sparse_graph_from_arrays(
+        max_vertex + 1,
+        sources,
+        targets,
+        weights,
+        directed=graph.type.directed,
+        weighted=graph.type.weighted,
+    )
+
+
+
+def as_csr_graph(graph, sort_by_degree=False):
+    """Copy a graph to a compact CSR graph.
+
+    The result is a sparse graph whose adjacency is also exposed as flat arrays with 
+    32-bit entries. Let n be the number of vertices and a the number of arcs, that is 
+    the number of edges for directed graphs and twice that for undirected graphs since 
+    each undirected edge is stored at both endpoints (self-loops once). The layout is 
 
+     * offsets: n+1 integers, the arcs of vertex v are at positions offsets[v] up to 
+       offsets[v+1] of the following arrays,
+     * targets: a integers, the target vertex of each arc, sorted per vertex,
+     * edge_ids: a integers, the edge of each arc,
+     * weights: a doubles, the weight of each arc, or None for unweighted graphs.
+
+    Vertices and edges of the copy are numbered from 0. Vertex v of the copy is 
+    original_vertices[v] of the input graph and edge e is original_edges[e]. The 
+    method :py:meth:`neighbors` of the result returns a view over the targets array 
+    without any copying.
+
+    .. note :: Like all sparse graphs the result is unmodifiable.
+
+    .. note :: The algorithms of the library run on a sparse graph in the isolate with
+               the same numbering. It is built from the arrays when the result is first
+               passed to an algorithm or queried through a method which does not read the
+               arrays, and uses roughly another 16 bytes per edge, plus 8 bytes per edge
+               for weighted graphs. Code which only reads the arrays never pays for it.
+               The arrays should not be modified before that copy is built.
+
+    :param graph: the input graph
+    :param sort_by_degree: if True vertices are relabeled in decreasing order of their 
+      degree (in plus out degree for directed graphs), which places hubs next to each 
+      other in memory. Otherwise vertices follow the iteration order of the input graph
+    :returns: a CSR graph
+    :rtype: :class:`jgrapht.types.Graph`
+    """
+    n = graph.number_of_vertices()
+    m = graph.number_of_edges()
+    directed = graph.type.directed
+    capacity = m if directed else 2 * m
+
+    original_vertices = _int_array(n)
+    offsets = _int_array(n + 1)
+    targets = _int_array(capacity)
+    edge_ids = _int_array(capacity)
+    weights = _double_array(capacity) if graph.type.weighted else None
+    original_edges = _int_array(m)
+
+    arcs = backend.jgrapht_graph_csr_create(
+        graph.handle,
+        sort_by_degree,
+        original_vertices,
+        offsets,
+        targets,
+        edge_ids,
+        weights,
+        original_edges,
+    )
+    del targets[arcs:]
+    del edge_ids[arcs:]
+    if weights is not None:
+        del weights[arcs:]
+
+    return _JGraphTCSRGraph(
+        directed, offsets, targets, edge_ids, weights, original_vertices, original_edges
+    )
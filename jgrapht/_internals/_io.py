@@ -0,0 +1,96 @@
+from .. import backend
+from ._wrappers import _NativeHandleWrapper
+from ._graphs import _JGraphTGraph
+
+from array import array
+import codecs
+
+
+class _JGraphTEdgeListStreamImporter(_NativeHandleWrapper):
+    """A streaming edge list importer kept by the native backend code.
+
+    Input is pushed in blocks of any size. Lines do not need to be aligned with the
+    blocks. When an identifier callback is given, lines are split in Python and the
+    callback is called once per distinct identifier. Otherwise parsing happens
+    entirely in the backend.
+    """
+
+    def __init__(self, handle, weighted, delimiter, import_id_cb=None, **kwargs):
+        super().__init__(handle=handle, **kwargs)
+        self._weighted = weighted
+        self._delimiter = delimiter
+        self._import_id_cb = import_id_cb
+        self._ids = dict()
+        self._carry = ""
+        self._decoder = codecs.getincrementaldecoder("utf-8")()
+
+    def push(self, data):
+        """Push a block of input.
+
+        :param data: a bytes like object or a string
+        """
+        if self._import_id_cb is None:
+            if isinstance(data, str):
+                data = data.encode("utf-8")
+            backend.jgrapht_import_edgelist_stream_push(self._handle, data)
+            return
+
+        if not isinstance(data, str):
+            data = self._decoder.decode(bytes(data))
+        lines = (self._carry + data).split("\n")
+        self._carry = lines.pop()
+        self._push_lines(lines)
+
+    def finish(self, num_vertices=None):
+        """Finish the import and build the graph.
+
+        :param num_vertices: number of vertices of the graph. If None, the largest vertex
+          plus one
+        :returns: a sparse graph
+        """
+        if self._import_id_cb is not None:
+            try:
+                tail = self._decoder.decode(b"", final=True)
+            except UnicodeDecodeError as e:
+                raise IOError("Invalid input: {}".format(e))
+            self._carry += tail
+        if self._carry:
+            self._push_lines([self._carry])
+            self._carry = ""
+        handle = backend.jgrapht_import_edgelist_stream_finish(
+            self._handle, -1 if num_vertices is None else num_vertices
+        )
+        return _JGraphTGraph(handle)
+
+    def _push_lines(self, lines):
+        sources = array("i")
+        targets = array("i")
+        weights = array("d") if self._weighted else None
+        separator = None if self._delimiter.isspace() else self._delimiter
+        for line in lines:
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            fields = [f.strip() for f in line.split(separator)]
+            if len(fields) < 2:
+                raise IOError("Invalid line: {}".format(line))
+            sources.append(self._vertex(fields[0]))
+            targets.append(self._vertex(fields[1]))
+            if self._weighted:
+                weights.append(float(fields[2]) if len(fields) > 2 else 1.0)
+        backend.jgrapht_import_edgelist_stream_push_edges(
+            self._handle, sources, targets, weights
+        )
+
+    def _vertex(self, identifier):
+        v = self._ids.get(identifier)
+        if v is None:
+            v = self._import_id_cb(identifier)
+            self._ids[identifier] = v
+        return v
+
+    def _destroy(self):
+        backend.jgrapht_import_edgelist_stream_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTEdgeListStreamImporter(%r)" % self._handle
@@ -0,0 +1,76 @@
+from .. import backend
+
+from ._wrappers import _NativeHandleWrapper
+from ._arrays import (
+    _as_int_array,
+    _long_array,
+    _double_array,
+)
+
+
+class _JGraphTMetricsTracker(_NativeHandleWrapper):
+    """Triangle counts and clustering coefficients of a graph, maintained by the 
+    native code while the graph is modified.
+    """
+
+    def __init__(self, handle, graph, **kwargs):
+        super().__init__(handle=handle, **kwargs)
+        # keep the graph alive, the tracker is registered for its handle
+        self._graph = graph
+
+    @property
+    def graph(self):
+        return self._graph
+
+    @property
+    def triangles(self):
+        """Number of triangles in the graph."""
+        return backend.jgrapht_graph_metrics_tracker_triangles(self._handle)
+
+    @property
+    def global_clustering_coefficient(self):
+        """Three times the number of triangles over the number of paths of length two."""
+        global_cc, _ = backend.jgrapht_graph_metrics_tracker_clustering(self._handle)
+        return global_cc
+
+    @property
+    def average_clustering_coefficient(self):
+        """Average of the local clustering coefficients of all vertices."""
+        _, average_cc = backend.jgrapht_graph_metrics_tracker_clustering(self._handle)
+        return average_cc
+
+    def vertex_triangles(self, v):
+        """Number of triangles which contain a vertex."""
+        return self.vertices_triangles([v])[v]
+
+    def local_clustering_coefficient(self, v):
+        """Local clustering coefficient of a vertex."""
+        return self.local_clustering_coefficients([v])[v]
+
+    def vertices_triangles(self, vertices=None):
+        """Number of triangles which contain each vertex, as a dictionary."""
+        vertices, triangles = self._exec(vertices, True)
+        return dict(zip(vertices, triangles))
+
+    def local_clustering_coefficients(self, vertices=None):
+        """Local clustering coefficient of each vertex, as a dictionary."""
+        vertices, coefficients = self._exec(vertices, False)
+        return dict(zip(vertices, coefficients))
+
+    def _exec(self, vertices, triangles):
+        if vertices is None:
+            vertices = self._graph.vertices_as_array()
+        vertices = _as_int_array(vertices)
+        if triangles:
+            values = _long_array(len(vertices))
+            backend.jgrapht_graph_metrics_tracker_vertices(self._handle, vertices, values, None)
+        else:
+            values = _double_array(len(vertices))
+            backend.jgrapht_graph_metrics_tracker_vertices(self._handle, vertices, None, values)
+        return vertices, values
+
+    def _destroy(self):
+        backend.jgrapht_graph_metrics_tracker_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTMetricsTracker(%r)" % self._handle
@@ -3,12 +3,20 @@ from ..types import (
     GraphPath,
     SingleSourcePaths,
     AllPairsPaths,
+    ShortestPathIndex,
 )
 from ._wrappers import (
     _HandleWrapper,
+    _NativeHandleWrapper,
     _JGraphTIntegerIterator,
     _JGraphTObjectIterator,
 )
+from ._arrays import (
+    _int_array,
+    _double_array,
+    _as_int_array,
+)
+import math
 
 
 class _JGraphTGraphPath(_HandleWrapper, GraphPath):
@@ -133,4 +141,94 @@ class _JGraphTAllPairsPaths(_HandleWrapper, AllPairsPaths):
         return _JGraphTSingleSourcePaths(singlesource, source_vertex)
 
     def __repr__(self):
-        return "_JGraphTAllPairsPaths(%r)" % self._handle
\ No newline at end of file
+        return "_JGraphTAllPairsPaths(%r)" % self._handle
+
+class _NativeGraphPath(GraphPath):
+    """A graph path computed by the native backend code."""
+
+    def __init__(self, weight, start_vertex, end_vertex, edges):
+        self._weight = weight
+        self._start_vertex = start_vertex
+        self._end_vertex = end_vertex
+        self._edges = edges
+
+    @property
+    def weight(self):
+        """The weight of the path."""
+        return self._weight
+
+    @property
+    def start_vertex(self):
+        """The starting vertex of the path."""
+        return self._start_vertex
+
+    @property
+    def end_vertex(self):
+        """The ending vertex of the path."""
+        return self._end_vertex
+
+    @property
+    def edges(self):
+        """A list of edges of the path."""
+        return self._edges
+
+    def __iter__(self):
+        return self._edges.__iter__()
+
+    def __repr__(self):
+        return "_NativeGraphPath(%r, %r, %r)" % (self._weight, self._start_vertex, self._end_vertex)
+
+
+class _JGraphTShortestPaths(_NativeHandleWrapper):
+    """The edges of one or more shortest paths computed by the native code."""
+
+    def __init__(self, handle, **kwargs):
+        super().__init__(handle=handle, **kwargs)
+
+    def copy(self, size):
+        """Copy the size edges of the paths into a new array."""
+        edges = _int_array(size)
+        backend.jgrapht_sp_paths_copy(self._handle, edges)
+        return edges
+
+    def _destroy(self):
+        backend.jgrapht_sp_paths_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTShortestPaths(%r)" % self._handle
+
+
+class _JGraphTShortestPathIndex(_NativeHandleWrapper, ShortestPathIndex):
+    """A shortest path index kept by the native backend code."""
+
+    def __init__(self, handle, **kwargs):
+        super().__init__(handle=handle, **kwargs)
+
+    def query(self, source_vertex, target_vertex):
+        weight, length, edges_handle = backend.jgrapht_sp_index_query_path(
+            self._handle, source_vertex, target_vertex
+        )
+        edges = _JGraphTShortestPaths(edges_handle).copy(length)
+        if math.isinf(weight):
+            return None
+        return _NativeGraphPath(weight, source_vertex, target_vertex, list(edges))
+
+    def distance(self, source_vertex, target_vertex):
+        return backend.jgrapht_sp_index_query_distance(
+            self._handle, source_vertex, target_vertex
+        )
+
+    def query_many(self, source_vertices, target_vertices, parallelism=1):
+        sources = _as_int_array(source_vertices)
+        targets = _as_int_array(target_vertices)
+        distances = _double_array(len(sources))
+        backend.jgrapht_sp_index_query_distances(
+            self._handle, sources, targets, parallelism, distances
+        )
+        return distances
+
+    def _destroy(self):
+        backend.jgrapht_sp_index_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTShortestPathIndex(%r)" % self._handle
@@ -0,0 +1,59 @@
+from .. import backend
+
+
+def enable_backend_stats(enabled=True):
+    """Enable or disable measuring the calls into the backend.
+
+    While enabled, every call from Python into the native backend is counted together
+    with its wall time, the bytes of the array and buffer arguments and whether it
+    failed. The overhead is a few tens of nanoseconds per call, thus it can stay enabled
+    in production. Stats can also be enabled before importing the library by setting the
+    environment variable :code:`JGRAPHT_BACKEND_STATS` to 1.
+
+    Live handles are counted whether stats are enabled or not.
+
+    :param enabled: whether to measure calls
+    """
+    backend.jgrapht_stats_set_enabled(bool(enabled))
+
+
+def backend_stats(reset=False):
+    """Statistics about the calls into the backend.
+
+    The result is a dictionary with the following keys:
+
+     * :code:`enabled`: whether calls are currently measured,
+     * :code:`handles`: a dictionary with the number of backend handles :code:`created`
+       and :code:`destroyed` from Python and the number of :code:`live` ones. A live
+       count growing steadily over time points to a handle leak,
+     * :code:`calls`: a dictionary from the name of each backend function called since
+       stats were enabled or reset to a dictionary with its number of :code:`calls`,
+       the number of calls which raised an exception (:code:`errors`), the cumulative
+       wall time in seconds (:code:`time`) and the cumulative size in bytes of all
+       arrays and buffers passed to it (:code:`bytes`).
+
+    Functions with many calls but little time or data per call are the chatty call
+    sites worth replacing with their array variants.
+
+    :param reset: whether to zero the call counters after reading them. Handle counts are
+      never reset
+    :returns: a dictionary
+    """
+    calls = {}
+    for i in range(backend.jgrapht_stats_entries_count()):
+        name, count, errors, nanos, size = backend.jgrapht_stats_entry(i)
+        if count > 0:
+            calls[name] = {
+                "calls": count,
+                "errors": errors,
+                "time": nanos / 1e9,
+                "bytes": size,
+            }
+    if reset:
+        backend.jgrapht_stats_reset()
+    created, destroyed = backend.jgrapht_stats_handles()
+    return {
+        "enabled": bool(backend.jgrapht_stats_is_enabled()),
+        "handles": {"created": created, "destroyed": destroyed, "live": created - destroyed},
+        "calls": calls,
+    }
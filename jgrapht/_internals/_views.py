@@ -1,6 +1,7 @@
 from .. import backend
 from ..types import GraphType
 from ._graphs import _JGraphTGraph
+from ._arrays import _as_double_array
 
 import copy
 
@@ -103,4 +104,35 @@ class _EdgeReversedGraphView(_JGraphTGraph):
 
         :returns: The graph type.
         """
-        return self._type
\ No newline at end of file
+        return self._type
+
+
+class _WeightedGraphView(_JGraphTGraph):
+    def __init__(self, graph, weights):
+        res = backend.jgrapht_graph_as_weighted(graph.handle, _as_double_array(weights))
+
+        super().__init__(res, True)
+
+        self._type = GraphType(
+            directed=graph.type.directed,
+            allowing_self_loops=graph.type.allowing_self_loops,
+            allowing_multiple_edges=graph.type.allowing_multiple_edges,
+            weighted=True,
+            modifiable=False,
+        )
+
+        # Keep a reference to avoid gargage collection. This is important since the
+        # same picture is maintained inside the JVM.
+        self._graph = graph
+
+    @property
+    def type(self):
+        """Query the graph type.
+
+        :returns: The graph type.
+        """
+        return self._type
+
+    def set_weights(self, weights):
+        """Replace the weights of all edges, weights[e] becomes the weight of edge e."""
+        backend.jgrapht_graph_weighted_view_set_weights(self._handle, _as_double_array(weights))
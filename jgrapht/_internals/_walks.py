@@ -0,0 +1,86 @@
+from .. import backend
+
+from ._wrappers import _NativeHandleWrapper
+from ._arrays import _int_array
+
+
+# largest number of elements of an array passed to the backend
+_INT_MAX = 2 ** 31 - 1
+
+
+class _JGraphTRandomWalks(_NativeHandleWrapper):
+    """A generator of random walks computed by the native code. Walks are 
+    written as rows of a flat integer array with walk_length entries each.
+    """
+
+    def __init__(self, handle, walk_length, **kwargs):
+        super().__init__(handle=handle, **kwargs)
+        self._walk_length = walk_length
+
+    @property
+    def walk_length(self):
+        return self._walk_length
+
+    def __len__(self):
+        return backend.jgrapht_traverse_random_walks_count(self._handle)
+
+    def fill(self, first, out, lengths=None):
+        """Write walks first, first+1, ... into out and return the number of walks written.
+        If lengths is given the number of vertices of each walk is written into it.
+        """
+        return backend.jgrapht_traverse_random_walks_fill(self._handle, first, out, lengths)
+
+    def _fill_rows(self, first, rows, out, lengths=None):
+        written = self.fill(first, out, lengths)
+        if written != rows:
+            raise RuntimeError("Expected {} walks but {} were written".format(rows, written))
+
+    def fill_all(self, out, lengths=None):
+        """Write all walks into the buffer out, which may hold more than INT_MAX elements.
+        The buffer is filled in blocks of rows, each small enough for a single call.
+        If lengths is given the number of vertices of each walk is written into it.
+        """
+        view = memoryview(out)
+        if view.ndim != 1:
+            view = view.cast("B").cast(view.format)
+        total = len(self)
+        length = self._walk_length
+        if len(view) < total * length:
+            raise ValueError("Buffer smaller than the number of walks times their length")
+        if lengths is not None:
+            lengths = memoryview(lengths)
+            if len(lengths) < total:
+                raise ValueError("Lengths buffer smaller than the number of walks")
+        rows_per_call = max(1, _INT_MAX // max(1, length))
+        first = 0
+        while first < total:
+            rows = min(rows_per_call, total - first)
+            self._fill_rows(
+                first,
+                rows,
+                view[first * length : (first + rows) * length],
+                None if lengths is None else lengths[first : first + rows],
+            )
+            first += rows
+
+    def chunks(self, walks_per_chunk, with_lengths=False):
+        total = len(self)
+        first = 0
+        while first < total:
+            rows = min(walks_per_chunk, total - first)
+            out = _int_array(rows * self._walk_length)
+            if with_lengths:
+                lengths = _int_array(rows)
+                self._fill_rows(first, rows, out, lengths)
+                first += rows
+                yield out, lengths
+            else:
+                self._fill_rows(first, rows, out)
+                first += rows
+                yield out
+
+    def _destroy(self):
+        backend.jgrapht_traverse_random_walks_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTRandomWalks(%r)" % self._handle
@@ -1,7 +1,17 @@
 from .. import backend
+import threading
+from array import array
 from collections.abc import (
     Iterator,
 )
+from ._arrays import (
+    _int_array,
+    _double_array,
+)
+
+
+# the arenas entered by each thread, innermost last
+_arenas = threading.local()
 
 
 class _HandleWrapper:
@@ -9,8 +19,14 @@ class _HandleWrapper:
        on deletion.
     """
 
+    # whether arenas may adopt the wrapper and destroy its handle
+    _in_arenas = True
+
     def __init__(self, handle, **kwargs):
         self._handle = handle
+        stack = getattr(_arenas, "stack", None)
+        if stack and self._in_arenas:
+            stack[-1]._adopt(self)
         super().__init__()
 
     @property
@@ -18,13 +34,108 @@ class _HandleWrapper:
         return self._handle
 
     def __del__(self):
-        if backend.jgrapht_isolate_is_attached():
+        # the handle is None once an arena destroyed it
+        if self._handle is not None and backend.jgrapht_isolate_is_attached():
             backend.jgrapht_handles_destroy(self._handle)
 
     def __repr__(self):
         return "_HandleWrapper(%r)" % self._handle
 
 
+class _NativeHandleWrapper(_HandleWrapper):
+    """A handle wrapper of an object owned by the native code and not by the isolate.
+       Subclasses release it in :py:meth:`_destroy`. Arenas never adopt such objects
+       since their handles cannot be destroyed by the isolate.
+    """
+
+    _in_arenas = False
+
+    def _destroy(self):
+        raise NotImplementedError()
+
+    def __del__(self):
+        if self._handle is not None:
+            self._destroy()
+
+    def __repr__(self):
+        return "_NativeHandleWrapper(%r)" % self._handle
+
+
+class _HandleArena:
+    """Groups the handles of all wrappers created by the current thread while the arena
+    is active and destroys them using a single backend call.
+    """
+
+    def __init__(self):
+        self._wrappers = {}
+
+    def __enter__(self):
+        stack = getattr(_arenas, "stack", None)
+        if stack is None:
+            stack = _arenas.stack = []
+        stack.append(self)
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        _arenas.stack.remove(self)
+        self.clear()
+        return False
+
+    def _adopt(self, wrapper):
+        self._wrappers[id(wrapper)] = wrapper
+
+    def detach(self, wrapper):
+        """Remove an object from the arena, e.g. a result which should outlive it. The
+        object is then destroyed on its own when no longer referenced.
+
+        :param wrapper: an object created while the arena was active
+        :returns: the object
+        """
+        self._wrappers.pop(id(wrapper), None)
+        return wrapper
+
+    def clear(self):
+        """Destroy all handles of the arena so far. The arena stays active."""
+        wrappers, self._wrappers = self._wrappers, {}
+        if not wrappers:
+            return
+        handles = array("q", (int(w._handle) for w in wrappers.values()))
+        for w in wrappers.values():
+            w._handle = None
+        if backend.jgrapht_isolate_is_attached():
+            backend.jgrapht_handles_destroy_batch(handles)
+
+    def __len__(self):
+        return len(self._wrappers)
+
+    def __repr__(self):
+        return "_HandleArena(%d handles)" % len(self._wrappers)
+
+
+def handle_arena():
+    """Create an arena which destroys backend handles in bulk.
+
+    Every object backed by a handle of the backend, such as a graph, an iterator, a set
+    or a path, normally destroys its handle when it is garbage collected. Workloads
+    creating many short-lived objects thus pay for one backend call per object. Inside
+    a :code:`with` block using the arena, all such objects created by the current thread
+    are instead kept by the arena and their handles are destroyed with a single call
+    when the block exits::
+
+        with jgrapht.handle_arena():
+            for v in g.vertices():
+                total += sum(1 for _ in g.edges_of(v))
+
+    Objects created inside the block must not be used after it exits, except those
+    removed from the arena with :code:`detach`. Calling :code:`clear` destroys the
+    handles gathered so far, which bounds the memory used by long loops. Arenas can be
+    nested, objects join the innermost one.
+
+    :returns: an arena to be used as a context manager
+    """
+    return _HandleArena()
+
+
 class _JGraphTIntegerIterator(_HandleWrapper, Iterator):
     """Integer values iterator"""
 
@@ -37,6 +148,19 @@ class _JGraphTIntegerIterator(_HandleWrapper, Iterator):
             raise StopIteration()
         return backend.jgrapht_it_next_int(self._handle)
 
+    def next_array(self, size):
+        """Get up to size next values using a single backend call.
+
+        :param size: maximum number of values to return
+        :returns: an array with the values. It is shorter than size, or empty, when
+          the iterator is exhausted.
+        :rtype: :py:class:`array.array`
+        """
+        values = _int_array(size)
+        count = backend.jgrapht_it_next_int_array(self._handle, values)
+        del values[count:]
+        return values
+
     def __repr__(self):
         return "_JGraphTIntegerIterator(%r)" % self._handle
 
@@ -53,10 +177,103 @@ class _JGraphTDoubleIterator(_HandleWrapper, Iterator):
             raise StopIteration()
         return backend.jgrapht_it_next_double(self._handle)
 
+    def next_array(self, size):
+        """Get up to size next values using a single backend call.
+
+        :param size: maximum number of values to return
+        :returns: an array with the values. It is shorter than size, or empty, when
+          the iterator is exhausted.
+        :rtype: :py:class:`array.array`
+        """
+        values = _double_array(size)
+        count = backend.jgrapht_it_next_double_array(self._handle, values)
+        del values[count:]
+        return values
+
     def __repr__(self):
         return "_JGraphTDoubleIterator(%r)" % self._handle
 
 
+class _JGraphTPooledIterator(_NativeHandleWrapper, Iterator):
+    """An iterator over the vertices or edges of a graph which can be restarted, keeping
+    the same backend handle. Values are transferred in chunks using a reused buffer.
+    """
+
+    _SOURCES = {
+        "vertices": backend.ITERATOR_SOURCE_VERTICES,
+        "edges": backend.ITERATOR_SOURCE_EDGES,
+        "edges_of": backend.ITERATOR_SOURCE_EDGES_OF,
+        "outedges_of": backend.ITERATOR_SOURCE_OUT_EDGES_OF,
+        "inedges_of": backend.ITERATOR_SOURCE_IN_EDGES_OF,
+    }
+
+    def __init__(self, handle, chunk_size, **kwargs):
+        super().__init__(handle=handle, **kwargs)
+        self._buffer = _int_array(chunk_size)
+        self._count = 0
+        self._pos = 0
+
+    def reset(self, graph, source="vertices", vertex=None):
+        """Restart the iterator.
+
+        :param graph: the graph
+        :param source: what to iterate over, one of "vertices", "edges", "edges_of",
+          "outedges_of" and "inedges_of", the latter three with the vertex given
+        :param vertex: the vertex for the edge sources of a single vertex
+        :returns: the iterator itself
+        """
+        if source not in self._SOURCES:
+            raise ValueError("Unknown iterator source {}".format(source))
+        if vertex is None:
+            if source not in ("vertices", "edges"):
+                raise ValueError("A vertex is required for {}".format(source))
+            vertex = 0
+        self._count = self._pos = 0
+        backend.jgrapht_it_pool_reset(self._handle, graph.handle, self._SOURCES[source], vertex)
+        return self
+
+    def __next__(self):
+        if self._pos == self._count:
+            self._count = backend.jgrapht_it_pool_next_int_array(self._handle, self._buffer)
+            self._pos = 0
+            if self._count == 0:
+                raise StopIteration()
+        value = self._buffer[self._pos]
+        self._pos += 1
+        return value
+
+    def _destroy(self):
+        # the pool holds an iterator of the isolate
+        if backend.jgrapht_isolate_is_attached():
+            backend.jgrapht_it_pool_destroy(self._handle)
+
+    def __repr__(self):
+        return "_JGraphTPooledIterator(%r)" % self._handle
+
+
+def pooled_iterator(chunk_size=1024):
+    """Create an iterator over the vertices or edges of graphs which can be restarted.
+
+    Contrary to iterating over :code:`graph.edges_of(v)` and the like, which creates a
+    new backend iterator every time, the same iterator is restarted using its
+    :code:`reset(graph, source, vertex)` method, which returns the iterator itself::
+
+        it = jgrapht.pooled_iterator()
+        for v in g.vertices():
+            for e in it.reset(g, "edges_of", v):
+                ...
+
+    The iterator must not be reset while a loop over it is still running.
+
+    :param chunk_size: number of values transferred from the backend at once
+    :returns: an exhausted iterator, to be started with reset
+    """
+    if chunk_size < 1:
+        raise ValueError("Chunk size must be positive")
+    handle = backend.jgrapht_it_pool_create()
+    return _JGraphTPooledIterator(handle, chunk_size)
+
+
 class _JGraphTObjectIterator(_HandleWrapper, Iterator):
     """A JGraphT iterator. This iterator returns handles to 
     backend objects. 
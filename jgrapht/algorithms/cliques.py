@@ -1,5 +1,8 @@
 from .. import backend
-from .._internals._collections import _JGraphTIntegerSetIterator
+from .._internals._collections import (
+    _JGraphTIntegerSetIterator,
+    _JGraphTEnumerationBatchIterator,
+)
 
 
 def _clique_enumeration_alg(name, graph, *args):
@@ -83,3 +86,41 @@ def bron_kerbosch_with_degeneracy_ordering(graph, timeout=0):
     """
     custom = [timeout]
     return _clique_enumeration_alg("bron_kerbosch_pivot", graph, *custom)
+
+
+def bron_kerbosch_batches(
+    graph, batch_size=1024, min_size=1, max_results=None, timeout=0, threads=1
+):
+    r"""Bron-Kerbosch maximal clique enumeration in batches.
+
+    Runs the Bron-Kerbosch algorithm with pivot and degeneracy ordering on a snapshot
+    of the graph. Contrary to the other variants, cliques are not computed upfront.
+    The enumeration advances only when the next batch is requested and stops after
+    max_results cliques, which allows to inspect graphs with a huge number of cliques.
+
+    Each batch is a tuple (members, offsets) of integer arrays. The vertices of the i-th
+    clique of the batch are :code:`members[offsets[i]:offsets[i+1]]`.
+
+    With more than one thread, the subproblems rooted at each vertex of the degeneracy
+    ordering are distributed among the threads, which take the next root as soon as
+    they are idle. The order of the cliques then differs between runs. The timeout only
+    counts the time spent computing batches. When it expires the iterator returns the
+    cliques found so far and stops.
+
+    :param graph: The input graph which should be simple
+    :param batch_size: Maximum number of cliques in each batch
+    :param min_size: Report only maximal cliques with at least that many vertices
+    :param max_results: Stop after that many cliques. No limit if None
+    :param timeout: Timeout in seconds. No timeout if zero
+    :param threads: Number of threads. If zero or less all processors are used
+    :returns: An iterator over batches of maximal cliques
+    """
+    if max_results is None:
+        max_results = 0
+    if threads == 1 and timeout == 0:
+        handle = backend.jgrapht_clique_enumeration_create(graph.handle, min_size, max_results)
+    else:
+        handle = backend.jgrapht_clique_enumeration_create_parallel(
+            graph.handle, min_size, max_results, timeout, threads
+        )
+    return _JGraphTEnumerationBatchIterator(handle, batch_size)
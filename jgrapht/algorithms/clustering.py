@@ -1,5 +1,9 @@
 from .. import backend
-from .._internals._clustering import _JGraphTClustering
+from .._internals._clustering import (
+    _JGraphTClustering,
+    _JGraphTDenseClustering,
+)
+from .._internals._arrays import _int_array
 
 import time
 
@@ -38,7 +42,7 @@ def k_spanning_tree(graph, k):
     return _clustering_alg("k_spanning_tree", graph, *args)
 
 
-def label_propagation(graph, max_iterations=None, seed=None):
+def label_propagation(graph, max_iterations=None, seed=None, threads=None):
     r"""Label propagation clustering.
 
     The algorithm is a near linear time algorithm capable of discovering communities in large graphs.
@@ -55,14 +59,31 @@ def label_propagation(graph, max_iterations=None, seed=None):
     The algorithm is randomized, meaning that two runs on the same graph may return different results.
     If the user requires deterministic behavior, a random generator seed can be provided as a parameter.
 
+    If threads is not None the algorithm runs natively in parallel and asynchronously, each 
+    vertex adopts the most frequent label among its neighbors as soon as it is visited and 
+    threads read the labels while they are updated. Results are then reproducible only with a
+    single thread. The returned clustering also provides the dense arrays :code:`vertices` 
+    and :code:`labels` where vertex :code:`vertices[i]` belongs to cluster :code:`labels[i]`.
+    Directed graphs are treated as undirected.
+
     :param graph: the graph. Needs to be undirected
-    :param max_iterations: maximum number of iterations (None means no limit)
+    :param max_iterations: maximum number of iterations (None means no limit, except for the
+      native implementation which then stops after 1000 iterations)
     :param seed: seed for the random number generator, if None then the system time is used
+    :param threads: number of threads of the native parallel implementation. If zero or less all
+      processors are used. If None the sequential implementation is used
     :returns: a clustering as an instance of :py:class:`.Clustering`
     """
     if seed is None:
         seed = time.time()
     if max_iterations is None:
         max_iterations = 0
+    if threads is not None:
+        vertices = graph.vertices_as_array()
+        labels = _int_array(len(vertices))
+        count = backend.jgrapht_clustering_exec_label_propagation_parallel(
+            graph.handle, max_iterations, int(seed), threads, labels
+        )
+        return _JGraphTDenseClustering(vertices, labels, count)
     args = [max_iterations, seed]
     return _clustering_alg("label_propagation", graph, *args)
@@ -2,24 +2,55 @@ from .. import backend
 from .._internals._collections import (
     _JGraphTIntegerSetIterator
 )
+from .._internals._clustering import _JGraphTDenseClustering
+from .._internals._arrays import _int_array
 
-def is_weakly_connected(graph):
+def is_weakly_connected(graph, threads=None):
     """Computes weakly connected components in a directed graph or 
        connected components in an undirected graph. 
   
-    This is a simple BFS based implementation.
+    This is a simple BFS based implementation. If threads is not None the
+    components are computed by :py:meth:`weakly_connected_components`.
 
     Running time :math:`\mathcal{O}(n+m)`.
 
     :param graph: the graph.
+    :param threads: number of threads of the native parallel implementation. If zero or
+      less all processors are used. If None the BFS based implementation is used
     :returns: a tuple containing a boolean value on whether the graph is connected
       and an iterator over all connected components. Each component is represented
       as a vertex set
     """
+    if threads is not None:
+        components = weakly_connected_components(graph, threads=threads)
+        count = components.number_of_clusters()
+        sets = (set(components.ith_cluster(i)) for i in range(count))
+        return count <= 1, sets
     connected, sets = backend.jgrapht_connectivity_weak_exec_bfs(graph.handle)
     return connected, _JGraphTIntegerSetIterator(sets)
 
 
+def weakly_connected_components(graph, threads=1):
+    """Computes weakly connected components in a directed graph or 
+       connected components in an undirected graph, in parallel.
+
+    The edges are processed in parallel by a concurrent union-find structure which
+    always links the root with the larger position to the one with the smaller position,
+    thus no locks are needed. Components are numbered in the order of their first vertex
+    in the vertex set of the graph.
+
+    :param graph: the graph
+    :param threads: number of threads to use. If zero or less all processors are used
+    :returns: the components as an instance of :py:class:`.Clustering`, which additionally 
+      provides the dense arrays :code:`vertices` and :code:`labels` where vertex 
+      :code:`vertices[i]` belongs to component :code:`labels[i]`
+    """
+    vertices = graph.vertices_as_array()
+    labels = _int_array(len(vertices))
+    count = backend.jgrapht_connectivity_weak_exec_parallel(graph.handle, threads, labels)
+    return _JGraphTDenseClustering(vertices, labels, count)
+
+
 def is_strongly_connected_gabow(graph):
     """Computes strongly connected components in a directed graph. 
   
@@ -4,7 +4,8 @@ from .._internals._paths import (
     _JGraphTGraphPathIterator,
 )
 from .._internals._collections import (
-    _JGraphTIntegerListIterator
+    _JGraphTIntegerListIterator,
+    _JGraphTEnumerationBatchIterator,
 )
 
 
@@ -233,3 +234,35 @@ def enumerate_simple_cycles_hawick_james(graph):
     cycles_it = backend.jgrapht_cycles_simple_enumeration_exec_hawick_james(graph.handle)
     return _JGraphTIntegerListIterator(cycles_it)
 
+
+
+def enumerate_simple_cycles_batches(graph, batch_size=1024, min_size=1, max_results=None):
+    r"""Enumerate all simple cycles in a directed graph in batches.
+
+    Runs Johnson's algorithm on a snapshot of the graph. Cycles are not computed upfront,
+    the enumeration advances only when the next batch is requested and stops after
+    max_results cycles. Running time :math:`\mathcal{O}((n + m)(C+1))` where :math:`n` is
+    the number of vertices, :math:`m` the number of edges and :math:`C` the number of
+    simple cycles which are reported.
+
+    Each batch is a tuple (members, offsets) of integer arrays. The vertices of the i-th
+    cycle of the batch are :code:`members[offsets[i]:offsets[i+1]]` in the order they are
+    visited by the cycle.
+
+    .. note:: The algorithm supports self-loops. Multiple edges are reported once.
+
+    See the paper:
+
+     * D. B. Johnson, Finding all the elementary circuits of a directed graph,
+       SIAM J. Comput., 4 (1975), pp. 77-84.
+
+    :param graph: the graph. Must be directed
+    :param batch_size: maximum number of cycles in each batch
+    :param min_size: report only cycles with at least that many vertices
+    :param max_results: stop after that many cycles. No limit if None
+    :returns: an iterator over batches of cycles
+    """
+    if max_results is None:
+        max_results = 0
+    handle = backend.jgrapht_cycles_simple_enumeration_create(graph.handle, min_size, max_results)
+    return _JGraphTEnumerationBatchIterator(handle, batch_size)
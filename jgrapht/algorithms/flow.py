@@ -1,5 +1,5 @@
 from .. import backend
-from .._internals._flows import _JGraphTCut, _JGraphTFlow
+from .._internals._flows import _JGraphTCut, _JGraphTFlow, _JGraphTMaxFlowSolver
 
 
 def _maxflow_alg(name, graph, source, sink, *args):
@@ -120,3 +120,25 @@ def min_st_cut(graph, source, sink):
     """
     _, cut = push_relabel(graph, source, sink)
     return cut
+
+
+def solver(graph):
+    r"""Create a reusable maximum flow solver for a graph.
+
+    The residual network is built once from the current state of the graph, with the 
+    edge weights as capacities. The solver then answers batches of (source, sink) 
+    queries using Dinic's algorithm, optionally in parallel, and accepts capacity updates 
+    between batches without rebuilding the network. Later modifications of the graph 
+    itself are not seen by the solver.
+
+    Each query returns the maximum flow value and optionally the source side of a 
+    minimum cut as a bitmap, which avoids creating a set per query. Use 
+    :py:meth:`source_partition` of the solver to decode a single cut.
+
+    :param graph: The input graph. This can be either directed or undirected. Edge capacities
+                  are taken from the edge weights and must be non-negative.
+    :returns: a solver with methods max_flow_value, max_flow_values, set_capacities and 
+      source_partition
+    """
+    handle = backend.jgrapht_maxflow_solver_create(graph.handle)
+    return _JGraphTMaxFlowSolver(handle, graph.number_of_vertices())
@@ -1,8 +1,14 @@
+import time
+
 from .. import backend
 from .._internals._collections import (
     _JGraphTIntegerIterator,
     _JGraphTIntegerDoubleMap,
 ) 
+from .._internals._arrays import (
+    _as_int_array,
+    _as_double_array,
+)
 
 
 def _scoring_alg(name, graph, *args):
@@ -22,6 +28,13 @@ def _scoring_alg(name, graph, *args):
     return _JGraphTIntegerDoubleMap(handle=scores_handle)
 
 
+def _parallel_scoring_alg(name, graph, parallelism, *args):
+    # parallelism of zero or less uses all available processors
+    alg_method = getattr(backend, "jgrapht_scoring_exec_" + name + "_parallel")
+    scores_handle = alg_method(graph.handle, *args, parallelism)
+    return _JGraphTIntegerDoubleMap(handle=scores_handle)
+
+
 def alpha_centrality(
     graph,
     damping_factor=0.01,
@@ -33,21 +46,68 @@ def alpha_centrality(
     return _scoring_alg("alpha_centrality", graph, *custom)
 
 
-def betweenness_centrality(graph, incoming=False, normalize=False):
+def betweenness_centrality(
+    graph, incoming=False, normalize=False, parallelism=None, samples=None, seed=None
+):
     custom = [normalize]
+    if samples is not None:
+        # approximation using only samples pivot vertices as sources
+        if seed is None:
+            seed = int(time.time())
+        if parallelism is None:
+            parallelism = 1
+        scores_handle = backend.jgrapht_scoring_exec_betweenness_centrality_sampled(
+            graph.handle, normalize, samples, seed, parallelism
+        )
+        return _JGraphTIntegerDoubleMap(handle=scores_handle)
+    if parallelism is not None:
+        return _parallel_scoring_alg("betweenness_centrality", graph, parallelism, *custom)
     return _scoring_alg("betweenness_centrality", graph, *custom)
 
 
-def closeness_centrality(graph, incoming=False, normalize=True):
+def closeness_centrality(graph, incoming=False, normalize=True, parallelism=None):
     custom = [incoming, normalize]
+    if parallelism is not None:
+        return _parallel_scoring_alg("closeness_centrality", graph, parallelism, *custom)
     return _scoring_alg("closeness_centrality", graph, *custom)
 
 
-def harmonic_centrality(graph, incoming=False, normalize=True):
+def harmonic_centrality(graph, incoming=False, normalize=True, parallelism=None):
     custom = [incoming, normalize]
+    if parallelism is not None:
+        return _parallel_scoring_alg("harmonic_centrality", graph, parallelism, *custom)
     return _scoring_alg("harmonic_centrality", graph, *custom)
 
 
-def pagerank(graph, damping_factor=0.85, max_iterations=100, tolerance=0.0001):
+def _scores_as_arrays(scores):
+    if scores is None:
+        return None, None
+    if isinstance(scores, _JGraphTIntegerDoubleMap):
+        return scores.to_arrays()
+    return _as_int_array(scores.keys()), _as_double_array(scores.values())
+
+
+def pagerank(
+    graph,
+    damping_factor=0.85,
+    max_iterations=100,
+    tolerance=0.0001,
+    initial_scores=None,
+    personalization=None,
+):
     custom = [damping_factor, max_iterations, tolerance]
-    return _scoring_alg("pagerank", graph, *custom)
+    if initial_scores is None and personalization is None:
+        return _scoring_alg("pagerank", graph, *custom)
+
+    # warm start from previous scores and/or personalized random jumps
+    initial_keys, initial_values = _scores_as_arrays(initial_scores)
+    personalization_keys, personalization_values = _scores_as_arrays(personalization)
+    scores_handle = backend.jgrapht_scoring_exec_custom_pagerank_warm_start(
+        graph.handle,
+        *custom,
+        initial_keys,
+        initial_values,
+        personalization_keys,
+        personalization_values
+    )
+    return _JGraphTIntegerDoubleMap(handle=scores_handle)
@@ -4,11 +4,21 @@ from .._internals._paths import (
     _JGraphTGraphPathIterator,
     _JGraphTSingleSourcePaths,
     _JGraphTAllPairsPaths,
+    _JGraphTShortestPathIndex,
+    _JGraphTShortestPaths,
+    _NativeGraphPath,
 )
+from .._internals._views import _WeightedGraphView
 from .._internals._collections import (
     _JGraphTIntegerSet,
 )
+from .._internals._arrays import (
+    _int_array,
+    _double_array,
+    _as_int_array,
+)
 import ctypes
+import math
 
 
 def _sp_singlesource_alg(name, graph, source_vertex):
@@ -75,7 +85,28 @@ def dijkstra(graph, source_vertex, target_vertex=None, use_bidirectional=True):
            bidirectional
     :returns: either a :py:class:`.GraphPath` or :py:class:`.SingleSourcePaths` depending on whether a
               target vertex is provided
+
+    .. note :: On a weighted view, see :py:meth:`jgrapht.views.as_weighted`, only the backend sees 
+              the weights of the view. A path between two vertices is then computed natively on a 
+              snapshot of the view by a unidirectional search, thus use_bidirectional must be 
+              False. Single-source paths are not supported. Use :py:meth:`dijkstra_between_pairs` 
+              or :py:meth:`distance_matrix` for many queries.
+
+    :raises ValueError: if the graph is a weighted view and either no target vertex is given or
+      use_bidirectional is True
     """
+    if isinstance(graph, _WeightedGraphView):
+        if target_vertex is None:
+            raise ValueError("Single-source paths not supported on weighted views")
+        if use_bidirectional:
+            raise ValueError("Bidirectional search not supported on weighted views")
+        distances, _, edges = dijkstra_between_pairs(
+            graph, [source_vertex], [target_vertex], with_paths=True
+        )
+        if math.isinf(distances[0]):
+            return None
+        return _NativeGraphPath(distances[0], source_vertex, target_vertex, list(edges))
+
     if target_vertex is None:
         return _sp_singlesource_alg(
             "dijkstra_get_singlesource_from_vertex", graph, source_vertex
@@ -97,6 +128,95 @@ def dijkstra(graph, source_vertex, target_vertex=None, use_bidirectional=True):
             )
 
 
+def dijkstra_between_pairs(
+    graph, source_vertices, target_vertices, with_paths=False, parallelism=1
+):
+    r"""Dijkstra's algorithm for many point-to-point queries.
+
+    Query i asks for the shortest path from source_vertices[i] to target_vertices[i].
+    All queries are answered using a single backend call. Queries which share their
+    source vertex share a single search and distinct sources are processed in parallel.
+    Negative edge weights are not allowed.
+
+    Every call on a graph first takes a snapshot of it, which costs :math:`\mathcal{O}(n+m)`
+    and a call into the isolate per vertex and edge. This dominates the latency of small
+    batches. Services answering many batches on the same graph should pass a
+    :py:class:`.ShortestPathIndex` returned by :py:meth:`alt_index` instead, whose snapshot
+    is then reused. The batch still uses Dijkstra's algorithm and not the landmarks.
+
+    :param graph: the graph, or a shortest path index built from it
+    :param source_vertices: an iterable or array of source vertices
+    :param target_vertices: an iterable or array of target vertices, of the same length
+    :param with_paths: whether to also return the edges of the paths
+    :param parallelism: number of threads to use. If zero or less all processors are used
+    :returns: an array with the distance of each query. Unreachable targets have infinite
+      distance. If with_paths is True a tuple (distances, offsets, edges) of arrays is
+      returned instead where the edges of path i are edges[offsets[i]:offsets[i+1]]
+    """
+    sources = _as_int_array(source_vertices)
+    targets = _as_int_array(target_vertices)
+    distances = _double_array(len(sources))
+    offsets = _int_array(len(sources) + 1) if with_paths else None
+
+    if isinstance(graph, _JGraphTShortestPathIndex):
+        batch = backend.jgrapht_sp_index_dijkstra_get_paths_between_vertex_pairs
+    else:
+        batch = backend.jgrapht_sp_exec_dijkstra_get_paths_between_vertex_pairs
+    edges_handle = batch(graph.handle, sources, targets, parallelism, distances, offsets)
+    if not with_paths:
+        return distances
+
+    edges = _JGraphTShortestPaths(edges_handle).copy(offsets[-1])
+    return distances, offsets, edges
+
+
+def distance_matrix(graph, vertices=None, out=None, parallelism=1):
+    """Compute the shortest path distances between all pairs of vertices.
+
+    One single-source shortest path computation is executed per vertex, in parallel,
+    and the distances are written directly into a contiguous buffer. Negative edge
+    weights are not allowed, use :py:meth:`johnson_allpairs` or
+    :py:meth:`floyd_warshall_allpairs` for such graphs.
+
+    :param graph: the graph
+    :param vertices: the vertices of the matrix and their order. If None all vertices of
+      the graph in iteration order are used. Paths may pass through any vertex of the graph
+    :param out: an optional writable buffer of doubles, such as an :py:class:`array.array`
+      or numpy array, with at least n*n elements where n is the number of vertices
+    :param parallelism: number of threads to use. If zero or less all processors are used
+    :returns: the buffer containing the n*n distance matrix in row-major order. Entry
+      i*n+j is the distance from vertices[i] to vertices[j] or infinity if there is no path
+    """
+    if vertices is None:
+        vertices = graph.vertices_as_array()
+    else:
+        vertices = _as_int_array(vertices)
+    n = len(vertices)
+    if out is None:
+        out = _double_array(n * n)
+    backend.jgrapht_sp_exec_allpairs_distance_matrix(graph.handle, vertices, parallelism, out)
+    return out
+
+
+def alt_index(graph, landmarks=16):
+    r"""Build a reusable index for point-to-point shortest path queries.
+
+    The index precomputes the distances from and to a set of landmark vertices and
+    answers queries using A* search with the ALT lower bounds (A*, landmarks and
+    the triangle inequality). Landmarks are selected greedily, each one farthest
+    away from the previous ones. Preprocessing runs :math:`\mathcal{O}(k)` single
+    source shortest path computations, where k is the number of landmarks, and
+    stores :math:`\mathcal{O}(k n)` distances. Negative edge weights are not allowed.
+
+    :param graph: the graph
+    :param landmarks: number of landmarks
+    :returns: a shortest path index
+    :rtype: :py:class:`.ShortestPathIndex`
+    """
+    handle = backend.jgrapht_sp_index_alt_create(graph.handle, landmarks)
+    return _JGraphTShortestPathIndex(handle)
+
+
 def bellman_ford(graph, source_vertex):
     r"""Bellman-Ford algorithm to compute single-source shortest paths.
 
@@ -134,6 +254,43 @@ def bfs(graph, source_vertex):
     )
 
 
+def bfs_multisource(graph, source_vertices, max_depth=None, with_parents=True, parallelism=1):
+    r"""Breadth-first search from a set of source vertices. Even if the graph has weights,
+    this algorithm treats the graph as unweighted.
+
+    All sources start at depth zero, thus the depth of a vertex is the number of hops
+    from its closest source. Levels are expanded in parallel and the search switches
+    between expanding the frontier (top-down) and looking for a parent of each unvisited
+    vertex (bottom-up) depending on the size of the frontier. Running time
+    :math:`\mathcal{O}(n+m)` per direction switch.
+
+    The results are dense arrays indexed by the position of each vertex in the vertex set
+    of the graph, that is, entry i belongs to vertex :code:`graph.vertices_as_array()[i]`.
+
+    :param graph: the graph
+    :param source_vertices: an iterable or array of source vertices
+    :param max_depth: vertices farther than max_depth hops are not visited. No limit if None
+    :param with_parents: whether to also compute the previous vertex on a shortest path
+    :param parallelism: number of threads to use. If zero or less all processors are used
+    :returns: an array with the depth of each vertex or -1 if the vertex was not visited.
+      If with_parents is True a tuple (depth, parent) of arrays is returned instead, where
+      the parent of the sources and of the unvisited vertices is -1. Since -1 may also be a 
+      vertex of the graph, the parent of a vertex is only meaningful if its depth is positive
+    """
+    sources = _as_int_array(source_vertices)
+    n = backend.jgrapht_graph_vertices_count(graph.handle)
+    depth = _int_array(n)
+    parent = _int_array(n) if with_parents else None
+    if max_depth is None:
+        max_depth = -1
+    backend.jgrapht_sp_exec_bfs_multisource(
+        graph.handle, sources, max_depth, parallelism, depth, parent
+    )
+    if not with_parents:
+        return depth
+    return depth, parent
+
+
 def johnson_allpairs(graph):
     r"""Johnson's all-pairs shortest-paths algorithm.
 
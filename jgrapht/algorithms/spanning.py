@@ -1,8 +1,16 @@
 from .. import backend
 from .._internals._collections import _JGraphTIntegerSet
+from .._internals._views import _WeightedGraphView
+from .._internals._arrays import _int_array
 
 
 def _mst_alg(name, graph):
+    if isinstance(graph, _WeightedGraphView):
+        # only the backend sees the weights of the view
+        edges = _int_array(max(graph.number_of_vertices() - 1, 0))
+        weight, count = backend.jgrapht_mst_exec_kruskal_edges(graph.handle, edges)
+        return weight, set(edges[:count])
+
     alg_method_name = "jgrapht_mst_exec_" + name
 
     try:
@@ -38,6 +46,11 @@ def prim(graph):
     achieve a running time of :math:`\mathcal{O}(m+n\log n)` where :math:`n` is the number of vertices and 
     :math:`m` the number of edges of the graph.
 
+    .. note :: On a weighted view, see :py:meth:`jgrapht.views.as_weighted`, the tree is computed 
+              by a native implementation of Kruskal's algorithm instead, since only the backend 
+              sees the weights of the view. The weight is the same, but among trees of equal 
+              weight a different one may be returned.
+
     :param graph: The input graph
     :returns: A tuple (weight, mst) 
     """
@@ -53,6 +66,11 @@ def boruvka(graph):
     assumption that the union-find uses path-compression.
     Here :math:`n` is the number of vertices and :math:`m` the number of edges of the graph.
 
+    .. note :: On a weighted view, see :py:meth:`jgrapht.views.as_weighted`, the tree is computed 
+              by a native implementation of Kruskal's algorithm instead, since only the backend 
+              sees the weights of the view. The weight is the same, but among trees of equal 
+              weight a different one may be returned.
+
     :param graph: The input graph
     :returns: A tuple (weight, mst) 
     """
@@ -32,12 +32,48 @@ int jgrapht_attributes_store_put_string_attribute(void *, int, char*, char*);
 
 int jgrapht_attributes_store_remove_attribute(void *, int, char*);
 
+int jgrapht_attributes_store_put_boolean_column(void *, int *, int, char*, int *, int);
+
+int jgrapht_attributes_store_put_int_column(void *, int *, int, char*, int *, int);
+
+int jgrapht_attributes_store_put_double_column(void *, int *, int, char*, double *, int);
+
+int jgrapht_attributes_store_put_string_column(void *, int *, int, char*, char *, int);
+
 int jgrapht_attributes_registry_create(void**);
 
 int jgrapht_attributes_registry_register_attribute(void *, char*, char*, char*, char*);
 
 int jgrapht_attributes_registry_unregister_attribute(void *, char*, char*, char*, char*);
 
+// attribute columns 
+
+typedef enum { 
+    ATTRIBUTE_COLUMN_INT = 0,
+    ATTRIBUTE_COLUMN_DOUBLE,
+    ATTRIBUTE_COLUMN_STRING,
+} attribute_column_type_t;
+
+int jgrapht_attributes_columns_create(void**);
+
+int jgrapht_attributes_columns_destroy(void *);
+
+int jgrapht_attributes_columns_bind(void *, int, long long*);
+
+int jgrapht_attributes_columns_count(void *, int*);
+
+int jgrapht_attributes_columns_key(void *, int, char**);
+
+int jgrapht_attributes_columns_info(void *, int, int*, int*, int*);
+
+int jgrapht_attributes_columns_ids(void *, int, int *, int);
+
+int jgrapht_attributes_columns_int_values(void *, int, int *, int);
+
+int jgrapht_attributes_columns_double_values(void *, int, double *, int);
+
+int jgrapht_attributes_columns_string_values(void *, int, char *, int);
+
 // clique
 
 int jgrapht_clique_exec_bron_kerbosch(void *, long long int, void**);
@@ -46,12 +82,18 @@ int jgrapht_clique_exec_bron_kerbosch_pivot(void *, long long int, void**);
 
 int jgrapht_clique_exec_bron_kerbosch_pivot_degeneracy_ordering(void *, long long int, void**);
 
+int jgrapht_clique_enumeration_create(void *, int, long long int, void**);
+
+int jgrapht_clique_enumeration_create_parallel(void *, int, long long int, long long int, int, void**);
+
 // clustering
 
 int jgrapht_clustering_exec_k_spanning_tree(void *, int, void**);
 
 int jgrapht_clustering_exec_label_propagation(void *, int, long long int, void**);
 
+int jgrapht_clustering_exec_label_propagation_parallel(void *, int, long long int, int, int *, int, int*);
+
 int jgrapht_clustering_get_number_clusters(void *, int*);
 
 int jgrapht_clustering_ith_cluster_vit(void *, int, void**);
@@ -82,6 +124,8 @@ int jgrapht_connectivity_strong_exec_gabow(void *, int*, void**);
 
 int jgrapht_connectivity_weak_exec_bfs(void *, int*, void**);
 
+int jgrapht_connectivity_weak_exec_parallel(void *, int, int *, int, int*);
+
 // cut
 
 int jgrapht_cut_exec_stoer_wagner(void *, double*, void**);
@@ -102,12 +146,22 @@ int jgrapht_cycles_simple_enumeration_exec_johnson(void *, void**);
 
 int jgrapht_cycles_simple_enumeration_exec_hawick_james(void *, void**);
 
+int jgrapht_cycles_simple_enumeration_create(void *, int, long long int, void**);
+
 int jgrapht_cycles_fundamental_basis_exec_queue_bfs(void *, double*, void**);
 
 int jgrapht_cycles_fundamental_basis_exec_stack_bfs(void *, double*, void**);
 
 int jgrapht_cycles_fundamental_basis_exec_paton(void *, double*, void**);
 
+// enumeration
+
+int jgrapht_enumeration_destroy(void *);
+
+int jgrapht_enumeration_next_batch(void *, int, int*, int*);
+
+int jgrapht_enumeration_batch_copy(void *, int *, int, int *, int);
+
 // error
 
 void jgrapht_error_clear_errno();
@@ -116,6 +170,8 @@ int jgrapht_error_get_errno();
 
 char *jgrapht_error_get_errno_msg();
 
+int jgrapht_error_set_errno(status_t, const char *);
+
 void jgrapht_error_print_stack_trace();
 
 // exporter
@@ -160,6 +216,20 @@ int jgrapht_export_file_graphml(void *, char*, void *, void *, void *, int, int,
 
 int jgrapht_export_string_graphml(void *, void *, void *, void *, int, int, int, void**);
 
+int jgrapht_export_file_binary(void *, char*);
+
+int jgrapht_export_file_csv_edgelist_parallel(void *, char*, int, int);
+
+int jgrapht_export_file_json_parallel(void *, char*, int);
+
+int jgrapht_export_sink_csv_edgelist_parallel(void *, int, int, void *);
+
+int jgrapht_export_sink_json_parallel(void *, int, void *);
+
+int jgrapht_export_sink_binary(void *, void *);
+
+int jgrapht_export_sink_string(void *, void *);
+
 // flow 
 
 int jgrapht_maxflow_exec_push_relabel(void *, int, int, double*, void**, void**);
@@ -168,6 +238,16 @@ int jgrapht_maxflow_exec_dinic(void *, int, int, double*, void**, void**);
 
 int jgrapht_maxflow_exec_edmonds_karp(void *, int, int, double*, void**, void**);
 
+int jgrapht_maxflow_solver_create(void *, void**);
+
+int jgrapht_maxflow_solver_destroy(void *);
+
+int jgrapht_maxflow_solver_vertices(void *, int *, int, int*);
+
+int jgrapht_maxflow_solver_set_capacities(void *, int *, int, double *, int);
+
+int jgrapht_maxflow_solver_exec_batch(void *, int *, int, int *, int, int, double *, int, int *, int);
+
 int jgrapht_mincostflow_exec_capacity_scaling(void *, void *, void *, void *, int, double*, void**, void**);
 
 // generate
@@ -200,6 +280,12 @@ int jgrapht_graph_create(int, int, int, int, void**);
 
 int jgrapht_graph_sparse_create(int, int, int, void *, void**);
 
+int jgrapht_graph_sparse_create_from_arrays(int, int, int, int *, int, int *, int, double *, int, void**);
+
+int jgrapht_graph_csr_create(void *, int, int *, int, int *, int, int *, int, int *, int, double *, int, int *, int, int*);
+
+int jgrapht_graph_sparse_create_from_csr(int, int *, int, int *, int, int *, int, double *, int, void**);
+
 int jgrapht_graph_vertices_count(void *, int*);
 
 int jgrapht_graph_edges_count(void *, int*);
@@ -266,6 +352,26 @@ int jgrapht_graph_as_unweighted(void *, void**);
 
 int jgrapht_graph_as_edgereversed(void *, void**);
 
+int jgrapht_graph_as_weighted(void *, double *, int, void**);
+
+int jgrapht_graph_weighted_view_set_weights(void *, double *, int);
+
+int jgrapht_graph_add_vertices(void *, int *, int);
+
+int jgrapht_graph_add_given_vertices(void *, int *, int, int *, int);
+
+int jgrapht_graph_add_edges(void *, int *, int, int *, int, double *, int, int *, int);
+
+int jgrapht_graph_remove_edges(void *, int *, int, int*);
+
+int jgrapht_graph_set_edge_weights(void *, int *, int, double *, int);
+
+int jgrapht_graph_vertices_array(void *, int *, int, int*);
+
+int jgrapht_graph_edges_array(void *, int *, int, int*);
+
+int jgrapht_graph_edges_endpoints_array(void *, int *, int, int *, int, int *, int, double *, int);
+
 // graph metrics
 
 int jgrapht_graph_metrics_diameter(void *, double*);
@@ -278,6 +384,18 @@ int jgrapht_graph_metrics_triangles(void *, long long int*);
 
 int jgrapht_graph_metrics_measure_graph(void *, double*, double*, void**, void**, void**, void**);
 
+int jgrapht_graph_metrics_triangles_parallel(void *, int, long long int*);
+
+int jgrapht_graph_metrics_tracker_create(void *, void**);
+
+int jgrapht_graph_metrics_tracker_destroy(void *);
+
+int jgrapht_graph_metrics_tracker_triangles(void *, long long int*);
+
+int jgrapht_graph_metrics_tracker_vertices(void *, int *, int, long long int *, int, double *, int);
+
+int jgrapht_graph_metrics_tracker_clustering(void *, double*, double*);
+
 // graph path 
 
 int jgrapht_graphpath_get_fields(void *, double*, int*, int*, void**);
@@ -334,6 +452,8 @@ int jgrapht_graph_test_is_k5_subdivision(void *, int*);
 
 int jgrapht_handles_destroy(void *);
 
+int jgrapht_handles_destroy_batch(long long int *, int);
+
 int jgrapht_handles_get_ccharpointer(void *, char**);
 
 // importers
@@ -374,6 +494,18 @@ int jgrapht_import_file_graph6sparse6(void *, char*, void *, void *, void *);
 
 int jgrapht_import_string_graph6sparse6(void *, char*, void *, void *, void *);
 
+int jgrapht_import_file_binary(char*, void**);
+
+int jgrapht_import_edgelist_stream_create(int, int, char*, void**);
+
+int jgrapht_import_edgelist_stream_destroy(void *);
+
+int jgrapht_import_edgelist_stream_push(void *, char *, int);
+
+int jgrapht_import_edgelist_stream_push_edges(void *, int *, int, int *, int, double *, int);
+
+int jgrapht_import_edgelist_stream_finish(void *, int, void**);
+
 // isomorphism
 
 int jgrapht_isomorphism_exec_vf2(void *, void *, int*, void**);
@@ -394,6 +526,26 @@ int jgrapht_it_next_object(void *, void**);
 
 int jgrapht_it_hasnext(void *, int*);
 
+int jgrapht_it_next_int_array(void *, int *, int, int*);
+
+int jgrapht_it_next_double_array(void *, double *, int, int*);
+
+typedef enum { 
+    ITERATOR_SOURCE_VERTICES = 0,
+    ITERATOR_SOURCE_EDGES,
+    ITERATOR_SOURCE_EDGES_OF,
+    ITERATOR_SOURCE_OUT_EDGES_OF,
+    ITERATOR_SOURCE_IN_EDGES_OF,
+} iterator_source_t;
+
+int jgrapht_it_pool_create(void**);
+
+int jgrapht_it_pool_reset(void *, void *, int, int);
+
+int jgrapht_it_pool_next_int_array(void *, int *, int, int*);
+
+int jgrapht_it_pool_destroy(void *);
+
 // list
 
 int jgrapht_list_create(void**);
@@ -448,6 +600,10 @@ int jgrapht_map_int_int_remove(void *, int, int*);
 
 int jgrapht_map_clear(void *);
 
+int jgrapht_map_int_double_to_arrays(void *, int *, int, double *, int, int*);
+
+int jgrapht_map_int_int_to_arrays(void *, int *, int, int *, int, int*);
+
 // matching
 
 int jgrapht_matching_exec_greedy_general_max_card(void *, double*, void**);
@@ -482,6 +638,8 @@ int jgrapht_matching_exec_bipartite_max_weight(void *, double*, void**);
 
 int jgrapht_mst_exec_kruskal(void *, double*, void**);
 
+int jgrapht_mst_exec_kruskal_edges(void *, double*, int *, int, int*);
+
 int jgrapht_mst_exec_prim(void *, double*, void**);
 
 int jgrapht_mst_exec_boruvka(void *, double*, void**);
@@ -518,6 +676,16 @@ int jgrapht_scoring_exec_pagerank(void *, void**);
 
 int jgrapht_scoring_exec_custom_pagerank(void *, double, int, double, void**);
 
+int jgrapht_scoring_exec_betweenness_centrality_parallel(void *, int, int, void**);
+
+int jgrapht_scoring_exec_betweenness_centrality_sampled(void *, int, int, long long int, int, void**);
+
+int jgrapht_scoring_exec_closeness_centrality_parallel(void *, int, int, int, void**);
+
+int jgrapht_scoring_exec_harmonic_centrality_parallel(void *, int, int, int, void**);
+
+int jgrapht_scoring_exec_custom_pagerank_warm_start(void *, double, int, double, int *, int, double *, int, int *, int, double *, int, void**);
+
 // set
 
 int jgrapht_set_create(void**);
@@ -550,10 +718,32 @@ int jgrapht_sp_exec_bidirectional_dijkstra_get_path_between_vertices(void *, int
 
 int jgrapht_sp_exec_dijkstra_get_singlesource_from_vertex(void *, int, void**);
 
+int jgrapht_sp_exec_dijkstra_get_paths_between_vertex_pairs(void *, int *, int, int *, int, int, double *, int, int *, int, void**);
+
+int jgrapht_sp_exec_allpairs_distance_matrix(void *, int *, int, int, double *, int);
+
+int jgrapht_sp_paths_copy(void *, int *, int);
+
+int jgrapht_sp_paths_destroy(void *);
+
+int jgrapht_sp_index_alt_create(void *, int, void**);
+
+int jgrapht_sp_index_destroy(void *);
+
+int jgrapht_sp_index_query_distance(void *, int, int, double*);
+
+int jgrapht_sp_index_query_path(void *, int, int, double*, int*, void**);
+
+int jgrapht_sp_index_query_distances(void *, int *, int, int *, int, int, double *, int);
+
+int jgrapht_sp_index_dijkstra_get_paths_between_vertex_pairs(void *, int *, int, int *, int, int, double *, int, int *, int, void**);
+
 int jgrapht_sp_exec_bellmanford_get_singlesource_from_vertex(void *, int, void**);
 
 int jgrapht_sp_exec_bfs_get_singlesource_from_vertex(void *, int, void**);
 
+int jgrapht_sp_exec_bfs_multisource(void *, int *, int, int, int, int *, int, int *, int);
+
 int jgrapht_sp_exec_johnson_get_allpairs(void *, void**);
 
 int jgrapht_sp_exec_floydwarshall_get_allpairs(void *, void**);
@@ -580,6 +770,36 @@ int jgrapht_sp_exec_eppstein_get_k_paths_between_vertices(void *, int, int, int,
 
 int jgrapht_spanner_exec_greedy_multiplicative(void *, int, double*, void**);
 
+// stats
+
+typedef struct jgrapht_stats_entry jgrapht_stats_entry_t;
+
+int jgrapht_stats_set_enabled(int);
+
+int jgrapht_stats_is_enabled(int*);
+
+int jgrapht_stats_reset();
+
+int jgrapht_stats_entries_count(int*);
+
+int jgrapht_stats_entry(int, char**, long long*, long long*, long long*, long long*);
+
+int jgrapht_stats_handles(long long*, long long*);
+
+// hooks called by the SWIG wrappers, not exported to Python
+
+long long jgrapht_stats_call_begin(long long *);
+
+void jgrapht_stats_call_end(jgrapht_stats_entry_t **, const char *, long long, long long, int);
+
+void jgrapht_stats_add_bytes(long long);
+
+void jgrapht_stats_clear_bytes();
+
+void jgrapht_stats_handle_created(void *);
+
+void jgrapht_stats_handle_destroyed(void *);
+
 // tour
 
 int jgrapht_tour_tsp_random(void *, long long int, void**);
@@ -628,6 +848,14 @@ int jgrapht_traverse_create_closest_first_from_vertex_vit(void *, int, void**);
 
 int jgrapht_traverse_create_custom_closest_first_from_vertex_vit(void *, int, double, void**);
 
+int jgrapht_traverse_random_walks_create(void *, int *, int, int, int, int, double, double, long long int, int, void**);
+
+int jgrapht_traverse_random_walks_destroy(void *);
+
+int jgrapht_traverse_random_walks_count(void *, long long int*);
+
+int jgrapht_traverse_random_walks_fill(void *, long long int, int *, int, int *, int, int*);
+
 // vertex cover
 
 int jgrapht_vertexcover_exec_greedy(void *, double*, void**);
@@ -14,6 +14,7 @@
 }
 
 %typemap(argout,noblock=1) void **OUTPUT {
+    jgrapht_stats_handle_created(*$1);
     %append_output(SWIG_NewPointerObj(*$1, $*1_descriptor, SWIG_POINTER_NOSHADOW | %newpointer_flags));
 }
 
@@ -29,6 +30,116 @@
     $1 = PyLong_AsVoidPtr($input);    
 }
 
+// typemaps for passing arrays using the buffer protocol, e.g. array.array or
+// numpy arrays. IN_ARRAY buffers are read-only, INPLACE_ARRAY buffers are filled 
+// by the backend. None is translated to a NULL pointer with zero size. The size
+// of every buffer is accounted to the call in the backend stats.
+%{
+static int get_array_buffer(PyObject *obj, Py_buffer *view, int writable, char format, Py_ssize_t itemsize) { 
+    int flags = PyBUF_FORMAT | PyBUF_C_CONTIGUOUS;
+    if (writable) { 
+        flags |= PyBUF_WRITABLE;
+    }
+    if (PyObject_GetBuffer(obj, view, flags) != 0) { 
+        return -1;
+    }
+    const char *f = view->format;
+    if (f != NULL && (*f == '@' || *f == '=')) { 
+        f++;
+    }
+    if (view->itemsize != itemsize || f == NULL || f[0] != format || f[1] != '\0') { 
+        PyBuffer_Release(view);
+        PyErr_Format(PyExc_TypeError, "Array with item format '%c' expected", format);
+        return -1;
+    }
+    // sizes are passed to the backend as int
+    if (view->len / view->itemsize > INT_MAX) { 
+        PyBuffer_Release(view);
+        PyErr_SetString(PyExc_OverflowError, "Array with more than INT_MAX elements");
+        return -1;
+    }
+    return 0;
+}
+%}
+
+%define %array_typemaps(TYPE, FORMAT)
+%typemap(in) (TYPE *IN_ARRAY, int IN_ARRAY_SIZE) (Py_buffer view, int acquired = 0) { 
+    if ($input == Py_None) { 
+        $1 = NULL;
+        $2 = 0;
+    } else { 
+        if (get_array_buffer($input, &view, 0, FORMAT, sizeof(TYPE)) != 0) { 
+            SWIG_fail;
+        }
+        acquired = 1;
+        jgrapht_stats_add_bytes((long long) view.len);
+        $1 = (TYPE *) view.buf;
+        $2 = (int) (view.len / view.itemsize);
+    }
+}
+
+%typemap(freearg) (TYPE *IN_ARRAY, int IN_ARRAY_SIZE) { 
+    if (acquired$argnum) { 
+        PyBuffer_Release(&view$argnum);
+        jgrapht_stats_clear_bytes();
+    }
+}
+
+%typemap(in) (TYPE *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE) (Py_buffer view, int acquired = 0) { 
+    if ($input == Py_None) { 
+        $1 = NULL;
+        $2 = 0;
+    } else { 
+        if (get_array_buffer($input, &view, 1, FORMAT, sizeof(TYPE)) != 0) { 
+            SWIG_fail;
+        }
+        acquired = 1;
+        jgrapht_stats_add_bytes((long long) view.len);
+        $1 = (TYPE *) view.buf;
+        $2 = (int) (view.len / view.itemsize);
+    }
+}
+
+%typemap(freearg) (TYPE *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE) { 
+    if (acquired$argnum) { 
+        PyBuffer_Release(&view$argnum);
+        jgrapht_stats_clear_bytes();
+    }
+}
+%enddef
+
+%array_typemaps(int, 'i')
+%array_typemaps(double, 'd')
+%array_typemaps(long long int, 'q')
+
+// raw bytes from any object supporting the buffer protocol, e.g. bytes or bytearray.
+// INPLACE_BUFFER objects must be writable.
+%define %buffer_typemaps(NAME, FLAGS)
+%typemap(in) (char *NAME, int NAME##_SIZE) (Py_buffer view, int acquired = 0) { 
+    if (PyObject_GetBuffer($input, &view, FLAGS) != 0) { 
+        SWIG_fail;
+    }
+    acquired = 1;
+    if (view.len > INT_MAX) { 
+        PyErr_SetString(PyExc_OverflowError, "Buffer with more than INT_MAX bytes");
+        SWIG_fail;
+    }
+    jgrapht_stats_add_bytes((long long) view.len);
+    $1 = (char *) view.buf;
+    $2 = (int) view.len;
+}
+
+%typemap(freearg) (char *NAME, int NAME##_SIZE) { 
+    if (acquired$argnum) { 
+        PyBuffer_Release(&view$argnum);
+        jgrapht_stats_clear_bytes();
+    }
+}
+%enddef
+
+%buffer_typemaps(IN_BUFFER, PyBUF_SIMPLE)
+%buffer_typemaps(INPLACE_BUFFER, PyBUF_WRITABLE)
+
 enum status_t { 
     STATUS_SUCCESS = 0,
     STATUS_ERROR,
@@ -123,13 +234,299 @@ int raise_exception_on_error(int result) {
 }
 %}
 
+// every call is measured in the backend stats, see backend_stats.c. The
+// bytes of the array arguments are collected by the typemaps above while
+// converting the arguments and handed to the call when it starts.
 %exception { 
-    $action
+    {
+        static jgrapht_stats_entry_t *stats_entry = NULL;
+        long long stats_bytes = 0;
+        long long stats_start = jgrapht_stats_call_begin(&stats_bytes);
+        $action
+        jgrapht_stats_call_end(&stats_entry, "$symname", stats_start, stats_bytes, result);
+    }
     if (raise_exception_on_error(result)) { 
         SWIG_fail;
     }
 }
 
+// release the GIL around long running backend calls, allowing other python
+// threads to run in the meantime. Python callbacks which the backend invokes
+// during such a call (importer callbacks, the A* heuristic, etc.) go through
+// ctypes function pointers, which re-acquire the GIL before running any python
+// code. Errors are translated after the GIL has been re-acquired.
+%define %release_gil(function)
+%exception function {
+    {
+        static jgrapht_stats_entry_t *stats_entry = NULL;
+        long long stats_bytes = 0;
+        Py_BEGIN_ALLOW_THREADS
+        long long stats_start = jgrapht_stats_call_begin(&stats_bytes);
+        $action
+        jgrapht_stats_call_end(&stats_entry, "$symname", stats_start, stats_bytes, result);
+        Py_END_ALLOW_THREADS
+    }
+    if (raise_exception_on_error(result)) {
+        SWIG_fail;
+    }
+}
+%enddef
+
+// functions destroying a handle which was returned to python, used for the
+// live handle count of the backend stats
+%define %destroys_handle(function)
+%exception function {
+    {
+        static jgrapht_stats_entry_t *stats_entry = NULL;
+        long long stats_bytes = 0;
+        long long stats_start = jgrapht_stats_call_begin(&stats_bytes);
+        $action
+        jgrapht_stats_call_end(&stats_entry, "$symname", stats_start, stats_bytes, result);
+    }
+    if (raise_exception_on_error(result)) {
+        SWIG_fail;
+    }
+    jgrapht_stats_handle_destroyed(arg1);
+}
+%enddef
+
+// functions which are not measured, such as the stats queries themselves
+%define %uninstrumented(function)
+%exception function {
+    $action
+    if (raise_exception_on_error(result)) {
+        SWIG_fail;
+    }
+}
+%enddef
+
+%release_gil(jgrapht_clique_exec_bron_kerbosch)
+%release_gil(jgrapht_clique_exec_bron_kerbosch_pivot)
+%release_gil(jgrapht_clique_exec_bron_kerbosch_pivot_degeneracy_ordering)
+%release_gil(jgrapht_clique_enumeration_create)
+%release_gil(jgrapht_clique_enumeration_create_parallel)
+
+%release_gil(jgrapht_clustering_exec_k_spanning_tree)
+%release_gil(jgrapht_clustering_exec_label_propagation)
+%release_gil(jgrapht_clustering_exec_label_propagation_parallel)
+
+%release_gil(jgrapht_coloring_exec_greedy)
+%release_gil(jgrapht_coloring_exec_greedy_smallestdegreelast)
+%release_gil(jgrapht_coloring_exec_backtracking_brown)
+%release_gil(jgrapht_coloring_exec_greedy_largestdegreefirst)
+%release_gil(jgrapht_coloring_exec_greedy_random)
+%release_gil(jgrapht_coloring_exec_greedy_random_with_seed)
+%release_gil(jgrapht_coloring_exec_greedy_dsatur)
+%release_gil(jgrapht_coloring_exec_color_refinement)
+
+%release_gil(jgrapht_connectivity_strong_exec_kosaraju)
+%release_gil(jgrapht_connectivity_strong_exec_gabow)
+%release_gil(jgrapht_connectivity_weak_exec_bfs)
+%release_gil(jgrapht_connectivity_weak_exec_parallel)
+
+%release_gil(jgrapht_cut_exec_stoer_wagner)
+
+%release_gil(jgrapht_cycles_eulerian_exec_hierholzer)
+%release_gil(jgrapht_cycles_chinese_postman_exec_edmonds_johnson)
+%release_gil(jgrapht_cycles_simple_enumeration_exec_tarjan)
+%release_gil(jgrapht_cycles_simple_enumeration_exec_tiernan)
+%release_gil(jgrapht_cycles_simple_enumeration_exec_szwarcfiter_lauer)
+%release_gil(jgrapht_cycles_simple_enumeration_exec_johnson)
+%release_gil(jgrapht_cycles_simple_enumeration_exec_hawick_james)
+%release_gil(jgrapht_cycles_simple_enumeration_create)
+%release_gil(jgrapht_enumeration_next_batch)
+%release_gil(jgrapht_cycles_fundamental_basis_exec_queue_bfs)
+%release_gil(jgrapht_cycles_fundamental_basis_exec_stack_bfs)
+%release_gil(jgrapht_cycles_fundamental_basis_exec_paton)
+
+%release_gil(jgrapht_export_file_dimacs)
+%release_gil(jgrapht_export_string_dimacs)
+%release_gil(jgrapht_export_file_gml)
+%release_gil(jgrapht_export_string_gml)
+%release_gil(jgrapht_export_file_json)
+%release_gil(jgrapht_export_string_json)
+%release_gil(jgrapht_export_file_lemon)
+%release_gil(jgrapht_export_string_lemon)
+%release_gil(jgrapht_export_file_csv)
+%release_gil(jgrapht_export_string_csv)
+%release_gil(jgrapht_export_file_gexf)
+%release_gil(jgrapht_export_string_gexf)
+%release_gil(jgrapht_export_file_dot)
+%release_gil(jgrapht_export_string_dot)
+%release_gil(jgrapht_export_file_graph6)
+%release_gil(jgrapht_export_string_graph6)
+%release_gil(jgrapht_export_file_sparse6)
+%release_gil(jgrapht_export_string_sparse6)
+%release_gil(jgrapht_export_file_graphml)
+%release_gil(jgrapht_export_string_graphml)
+%release_gil(jgrapht_export_file_binary)
+%release_gil(jgrapht_export_file_csv_edgelist_parallel)
+%release_gil(jgrapht_export_file_json_parallel)
+%release_gil(jgrapht_export_sink_csv_edgelist_parallel)
+%release_gil(jgrapht_export_sink_json_parallel)
+%release_gil(jgrapht_export_sink_binary)
+
+%release_gil(jgrapht_maxflow_exec_push_relabel)
+%release_gil(jgrapht_maxflow_exec_dinic)
+%release_gil(jgrapht_maxflow_exec_edmonds_karp)
+%release_gil(jgrapht_maxflow_solver_create)
+%release_gil(jgrapht_maxflow_solver_exec_batch)
+
+%release_gil(jgrapht_mincostflow_exec_capacity_scaling)
+
+%release_gil(jgrapht_generate_barabasi_albert)
+%release_gil(jgrapht_generate_barabasi_albert_forest)
+%release_gil(jgrapht_generate_complete)
+%release_gil(jgrapht_generate_bipartite_complete)
+%release_gil(jgrapht_generate_empty)
+%release_gil(jgrapht_generate_gnm_random)
+%release_gil(jgrapht_generate_gnp_random)
+%release_gil(jgrapht_generate_ring)
+%release_gil(jgrapht_generate_scalefree)
+%release_gil(jgrapht_generate_watts_strogatz)
+%release_gil(jgrapht_generate_kleinberg_smallworld)
+
+%release_gil(jgrapht_graph_sparse_create_from_arrays)
+%release_gil(jgrapht_graph_csr_create)
+%release_gil(jgrapht_graph_sparse_create_from_csr)
+
+%release_gil(jgrapht_graph_metrics_diameter)
+%release_gil(jgrapht_graph_metrics_radius)
+%release_gil(jgrapht_graph_metrics_girth)
+%release_gil(jgrapht_graph_metrics_triangles)
+%release_gil(jgrapht_graph_metrics_measure_graph)
+%release_gil(jgrapht_graph_metrics_triangles_parallel)
+%release_gil(jgrapht_graph_metrics_tracker_create)
+
+%release_gil(jgrapht_import_file_dimacs)
+%release_gil(jgrapht_import_string_dimacs)
+%release_gil(jgrapht_import_file_gml)
+%release_gil(jgrapht_import_string_gml)
+%release_gil(jgrapht_import_file_json)
+%release_gil(jgrapht_import_string_json)
+%release_gil(jgrapht_import_file_csv)
+%release_gil(jgrapht_import_string_csv)
+%release_gil(jgrapht_import_file_gexf)
+%release_gil(jgrapht_import_string_gexf)
+%release_gil(jgrapht_import_file_graphml_simple)
+%release_gil(jgrapht_import_string_graphml_simple)
+%release_gil(jgrapht_import_file_graphml)
+%release_gil(jgrapht_import_string_graphml)
+%release_gil(jgrapht_import_file_dot)
+%release_gil(jgrapht_import_string_dot)
+%release_gil(jgrapht_import_file_graph6sparse6)
+%release_gil(jgrapht_import_string_graph6sparse6)
+%release_gil(jgrapht_import_file_binary)
+%release_gil(jgrapht_import_edgelist_stream_push)
+%release_gil(jgrapht_import_edgelist_stream_finish)
+
+%release_gil(jgrapht_isomorphism_exec_vf2)
+%release_gil(jgrapht_isomorphism_exec_vf2_subgraph)
+
+%release_gil(jgrapht_matching_exec_greedy_general_max_card)
+%release_gil(jgrapht_matching_exec_custom_greedy_general_max_card)
+%release_gil(jgrapht_matching_exec_edmonds_general_max_card_dense)
+%release_gil(jgrapht_matching_exec_edmonds_general_max_card_sparse)
+%release_gil(jgrapht_matching_exec_greedy_general_max_weight)
+%release_gil(jgrapht_matching_exec_custom_greedy_general_max_weight)
+%release_gil(jgrapht_matching_exec_pathgrowing_max_weight)
+%release_gil(jgrapht_matching_exec_blossom5_general_max_weight)
+%release_gil(jgrapht_matching_exec_blossom5_general_min_weight)
+%release_gil(jgrapht_matching_exec_blossom5_general_perfect_max_weight)
+%release_gil(jgrapht_matching_exec_blossom5_general_perfect_min_weight)
+%release_gil(jgrapht_matching_exec_bipartite_max_card)
+%release_gil(jgrapht_matching_exec_bipartite_perfect_min_weight)
+%release_gil(jgrapht_matching_exec_bipartite_max_weight)
+
+%release_gil(jgrapht_mst_exec_kruskal)
+%release_gil(jgrapht_mst_exec_kruskal_edges)
+%release_gil(jgrapht_mst_exec_prim)
+%release_gil(jgrapht_mst_exec_boruvka)
+
+%release_gil(jgrapht_partition_exec_bipartite)
+
+%release_gil(jgrapht_planarity_exec_boyer_myrvold)
+
+%release_gil(jgrapht_scoring_exec_alpha_centrality)
+%release_gil(jgrapht_scoring_exec_custom_alpha_centrality)
+%release_gil(jgrapht_scoring_exec_betweenness_centrality)
+%release_gil(jgrapht_scoring_exec_custom_betweenness_centrality)
+%release_gil(jgrapht_scoring_exec_closeness_centrality)
+%release_gil(jgrapht_scoring_exec_custom_closeness_centrality)
+%release_gil(jgrapht_scoring_exec_harmonic_centrality)
+%release_gil(jgrapht_scoring_exec_custom_harmonic_centrality)
+%release_gil(jgrapht_scoring_exec_pagerank)
+%release_gil(jgrapht_scoring_exec_custom_pagerank)
+%release_gil(jgrapht_scoring_exec_betweenness_centrality_parallel)
+%release_gil(jgrapht_scoring_exec_betweenness_centrality_sampled)
+%release_gil(jgrapht_scoring_exec_closeness_centrality_parallel)
+%release_gil(jgrapht_scoring_exec_harmonic_centrality_parallel)
+%release_gil(jgrapht_scoring_exec_custom_pagerank_warm_start)
+
+%release_gil(jgrapht_sp_exec_dijkstra_get_path_between_vertices)
+%release_gil(jgrapht_sp_exec_bidirectional_dijkstra_get_path_between_vertices)
+%release_gil(jgrapht_sp_exec_dijkstra_get_singlesource_from_vertex)
+%release_gil(jgrapht_sp_exec_dijkstra_get_paths_between_vertex_pairs)
+%release_gil(jgrapht_sp_exec_allpairs_distance_matrix)
+%release_gil(jgrapht_sp_index_alt_create)
+%release_gil(jgrapht_sp_index_query_distances)
+%release_gil(jgrapht_sp_index_dijkstra_get_paths_between_vertex_pairs)
+%release_gil(jgrapht_sp_exec_bellmanford_get_singlesource_from_vertex)
+%release_gil(jgrapht_sp_exec_bfs_get_singlesource_from_vertex)
+%release_gil(jgrapht_sp_exec_bfs_multisource)
+%release_gil(jgrapht_sp_exec_johnson_get_allpairs)
+%release_gil(jgrapht_sp_exec_floydwarshall_get_allpairs)
+%release_gil(jgrapht_sp_exec_astar_get_path_between_vertices)
+%release_gil(jgrapht_sp_exec_bidirectional_astar_get_path_between_vertices)
+%release_gil(jgrapht_sp_exec_astar_alt_heuristic_get_path_between_vertices)
+%release_gil(jgrapht_sp_exec_bidirectional_astar_alt_heuristic_get_path_between_vertices)
+%release_gil(jgrapht_sp_exec_yen_get_k_loopless_paths_between_vertices)
+%release_gil(jgrapht_sp_exec_eppstein_get_k_paths_between_vertices)
+
+%release_gil(jgrapht_spanner_exec_greedy_multiplicative)
+
+%release_gil(jgrapht_tour_tsp_random)
+%release_gil(jgrapht_tour_tsp_greedy_heuristic)
+%release_gil(jgrapht_tour_tsp_nearest_insertion_heuristic)
+%release_gil(jgrapht_tour_tsp_nearest_neighbor_heuristic)
+%release_gil(jgrapht_tour_metric_tsp_christofides)
+%release_gil(jgrapht_tour_metric_tsp_two_approx)
+%release_gil(jgrapht_tour_tsp_held_karp)
+%release_gil(jgrapht_tour_hamiltonian_palmer)
+%release_gil(jgrapht_tour_tsp_two_opt_heuristic)
+%release_gil(jgrapht_tour_tsp_two_opt_heuristic_improve)
+
+%release_gil(jgrapht_traverse_random_walks_create)
+%release_gil(jgrapht_traverse_random_walks_fill)
+
+%release_gil(jgrapht_vertexcover_exec_greedy)
+%release_gil(jgrapht_vertexcover_exec_greedy_weighted)
+%release_gil(jgrapht_vertexcover_exec_clarkson)
+%release_gil(jgrapht_vertexcover_exec_clarkson_weighted)
+%release_gil(jgrapht_vertexcover_exec_edgebased)
+%release_gil(jgrapht_vertexcover_exec_baryehudaeven)
+%release_gil(jgrapht_vertexcover_exec_baryehudaeven_weighted)
+%release_gil(jgrapht_vertexcover_exec_exact)
+%release_gil(jgrapht_vertexcover_exec_exact_weighted)
+
+%destroys_handle(jgrapht_handles_destroy)
+%destroys_handle(jgrapht_attributes_columns_destroy)
+%destroys_handle(jgrapht_enumeration_destroy)
+%destroys_handle(jgrapht_graph_metrics_tracker_destroy)
+%destroys_handle(jgrapht_import_edgelist_stream_destroy)
+%destroys_handle(jgrapht_it_pool_destroy)
+%destroys_handle(jgrapht_maxflow_solver_destroy)
+%destroys_handle(jgrapht_sp_paths_destroy)
+%destroys_handle(jgrapht_sp_index_destroy)
+%destroys_handle(jgrapht_traverse_random_walks_destroy)
+
+%uninstrumented(jgrapht_stats_set_enabled)
+%uninstrumented(jgrapht_stats_is_enabled)
+%uninstrumented(jgrapht_stats_reset)
+%uninstrumented(jgrapht_stats_entries_count)
+%uninstrumented(jgrapht_stats_entry)
+%uninstrumented(jgrapht_stats_handles)
+
 // ignore the integer return code
 // we already handled this using the exception 
 %typemap(out) int  "$result = SWIG_Py_Void();";
@@ -156,12 +553,48 @@ int jgrapht_attributes_store_put_string_attribute(void *, int, char*, char*);
 
 int jgrapht_attributes_store_remove_attribute(void *, int, char*);
 
+int jgrapht_attributes_store_put_boolean_column(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, char*, int *IN_ARRAY, int IN_ARRAY_SIZE);
+
+int jgrapht_attributes_store_put_int_column(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, char*, int *IN_ARRAY, int IN_ARRAY_SIZE);
+
+int jgrapht_attributes_store_put_double_column(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, char*, double *IN_ARRAY, int IN_ARRAY_SIZE);
+
+int jgrapht_attributes_store_put_string_column(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, char*, char *IN_BUFFER, int IN_BUFFER_SIZE);
+
 int jgrapht_attributes_registry_create(void** OUTPUT);
 
 int jgrapht_attributes_registry_register_attribute(void *, char*, char*, char*, char*);
 
 int jgrapht_attributes_registry_unregister_attribute(void *, char*, char*, char*, char*);
 
+// attribute columns 
+
+enum attribute_column_type_t { 
+    ATTRIBUTE_COLUMN_INT = 0,
+    ATTRIBUTE_COLUMN_DOUBLE,
+    ATTRIBUTE_COLUMN_STRING,
+};
+
+int jgrapht_attributes_columns_create(void** OUTPUT);
+
+int jgrapht_attributes_columns_destroy(void *);
+
+int jgrapht_attributes_columns_bind(void *, int, long long* OUTPUT);
+
+int jgrapht_attributes_columns_count(void *, int* OUTPUT);
+
+int jgrapht_attributes_columns_key(void *, int, char** OUTPUT);
+
+int jgrapht_attributes_columns_info(void *, int, int* OUTPUT, int* OUTPUT, int* OUTPUT);
+
+int jgrapht_attributes_columns_ids(void *, int, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_attributes_columns_int_values(void *, int, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_attributes_columns_double_values(void *, int, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_attributes_columns_string_values(void *, int, char *INPLACE_BUFFER, int INPLACE_BUFFER_SIZE);
+
 // clique
 
 int jgrapht_clique_exec_bron_kerbosch(void *, long long int, void** OUTPUT);
@@ -170,12 +603,18 @@ int jgrapht_clique_exec_bron_kerbosch_pivot(void *, long long int, void** OUTPUT
 
 int jgrapht_clique_exec_bron_kerbosch_pivot_degeneracy_ordering(void *, long long int, void** OUTPUT);
 
+int jgrapht_clique_enumeration_create(void *, int, long long int, void** OUTPUT);
+
+int jgrapht_clique_enumeration_create_parallel(void *, int, long long int, long long int, int, void** OUTPUT);
+
 // clustering
 
 int jgrapht_clustering_exec_k_spanning_tree(void *, int, void** OUTPUT);
 
 int jgrapht_clustering_exec_label_propagation(void *, int, long long int, void** OUTPUT);
 
+int jgrapht_clustering_exec_label_propagation_parallel(void *, int, long long int, int, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
 int jgrapht_clustering_get_number_clusters(void *, int* OUTPUT);
 
 int jgrapht_clustering_ith_cluster_vit(void *, int, void** OUTPUT);
@@ -206,6 +645,8 @@ int jgrapht_connectivity_strong_exec_gabow(void *, int* OUTPUT, void** OUTPUT);
 
 int jgrapht_connectivity_weak_exec_bfs(void *, int* OUTPUT, void** OUTPUT);
 
+int jgrapht_connectivity_weak_exec_parallel(void *, int, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
 // cut
 
 int jgrapht_cut_exec_stoer_wagner(void *, double* OUTPUT, void** OUTPUT);
@@ -226,12 +667,22 @@ int jgrapht_cycles_simple_enumeration_exec_johnson(void *, void** OUTPUT);
 
 int jgrapht_cycles_simple_enumeration_exec_hawick_james(void *, void** OUTPUT);
 
+int jgrapht_cycles_simple_enumeration_create(void *, int, long long int, void** OUTPUT);
+
 int jgrapht_cycles_fundamental_basis_exec_queue_bfs(void *, double* OUTPUT, void** OUTPUT);
 
 int jgrapht_cycles_fundamental_basis_exec_stack_bfs(void *, double* OUTPUT, void** OUTPUT);
 
 int jgrapht_cycles_fundamental_basis_exec_paton(void *, double* OUTPUT, void** OUTPUT);
 
+// enumeration
+
+int jgrapht_enumeration_destroy(void *);
+
+int jgrapht_enumeration_next_batch(void *, int, int* OUTPUT, int* OUTPUT);
+
+int jgrapht_enumeration_batch_copy(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
 
 // exporter
 
@@ -275,6 +726,20 @@ int jgrapht_export_file_graphml(void *, char*, void *, void *, void *, int, int,
 
 int jgrapht_export_string_graphml(void *, void *, void *, void *, int, int, int, void** OUTPUT);
 
+int jgrapht_export_file_binary(void *, char*);
+
+int jgrapht_export_file_csv_edgelist_parallel(void *, char*, int, int);
+
+int jgrapht_export_file_json_parallel(void *, char*, int);
+
+int jgrapht_export_sink_csv_edgelist_parallel(void *, int, int, void *LONG_TO_FUNCTION_POINTER);
+
+int jgrapht_export_sink_json_parallel(void *, int, void *LONG_TO_FUNCTION_POINTER);
+
+int jgrapht_export_sink_binary(void *, void *LONG_TO_FUNCTION_POINTER);
+
+int jgrapht_export_sink_string(void *, void *LONG_TO_FUNCTION_POINTER);
+
 // flow 
 
 int jgrapht_maxflow_exec_push_relabel(void *, int, int, double* OUTPUT, void** OUTPUT, void** OUTPUT);
@@ -283,6 +748,17 @@ int jgrapht_maxflow_exec_dinic(void *, int, int, double* OUTPUT, void** OUTPUT,
 
 int jgrapht_maxflow_exec_edmonds_karp(void *, int, int, double* OUTPUT, void** OUTPUT, void** OUTPUT);
 
+int jgrapht_maxflow_solver_create(void *, void** OUTPUT);
+
+int jgrapht_maxflow_solver_destroy(void *);
+
+int jgrapht_maxflow_solver_vertices(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
+int jgrapht_maxflow_solver_set_capacities(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, double *IN_ARRAY, int IN_ARRAY_SIZE);
+
+int jgrapht_maxflow_solver_exec_batch(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int *IN_ARRAY, int IN_ARRAY_SIZE, int, 
+    double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
 int jgrapht_mincostflow_exec_capacity_scaling(void *, void *, void *, void *, int, double* OUTPUT, void** OUTPUT, void** OUTPUT);
 
 // generate
@@ -315,6 +791,16 @@ int jgrapht_graph_create(int, int, int, int, void **OUTPUT);
 
 int jgrapht_graph_sparse_create(int, int, int, void *, void** OUTPUT);
 
+int jgrapht_graph_sparse_create_from_arrays(int, int, int, int *IN_ARRAY, int IN_ARRAY_SIZE, int *IN_ARRAY, int IN_ARRAY_SIZE, 
+    double *IN_ARRAY, int IN_ARRAY_SIZE, void** OUTPUT);
+
+int jgrapht_graph_csr_create(void *, int, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE,
+    int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE,
+    int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
+int jgrapht_graph_sparse_create_from_csr(int, int *IN_ARRAY, int IN_ARRAY_SIZE, int *IN_ARRAY, int IN_ARRAY_SIZE,
+    int *IN_ARRAY, int IN_ARRAY_SIZE, double *IN_ARRAY, int IN_ARRAY_SIZE, void** OUTPUT);
+
 int jgrapht_graph_vertices_count(void *, int* OUTPUT);
 
 int jgrapht_graph_edges_count(void *, int* OUTPUT);
@@ -381,6 +867,28 @@ int jgrapht_graph_as_unweighted(void *, void** OUTPUT);
 
 int jgrapht_graph_as_edgereversed(void *, void** OUTPUT);
 
+int jgrapht_graph_as_weighted(void *, double *IN_ARRAY, int IN_ARRAY_SIZE, void** OUTPUT);
+
+int jgrapht_graph_weighted_view_set_weights(void *, double *IN_ARRAY, int IN_ARRAY_SIZE);
+
+int jgrapht_graph_add_vertices(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_graph_add_given_vertices(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_graph_add_edges(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int *IN_ARRAY, int IN_ARRAY_SIZE, 
+    double *IN_ARRAY, int IN_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_graph_remove_edges(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int* OUTPUT);
+
+int jgrapht_graph_set_edge_weights(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, double *IN_ARRAY, int IN_ARRAY_SIZE);
+
+int jgrapht_graph_vertices_array(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
+int jgrapht_graph_edges_array(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
+int jgrapht_graph_edges_endpoints_array(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, 
+    int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
 // graph metrics
 
 int jgrapht_graph_metrics_diameter(void *, double* OUTPUT);
@@ -393,6 +901,19 @@ int jgrapht_graph_metrics_triangles(void *, long long int* OUTPUT);
 
 int jgrapht_graph_metrics_measure_graph(void *, double* OUTPUT, double* OUTPUT, void** OUTPUT, void** OUTPUT, void** OUTPUT, void** OUTPUT);
 
+int jgrapht_graph_metrics_triangles_parallel(void *, int, long long int* OUTPUT);
+
+int jgrapht_graph_metrics_tracker_create(void *, void** OUTPUT);
+
+int jgrapht_graph_metrics_tracker_destroy(void *);
+
+int jgrapht_graph_metrics_tracker_triangles(void *, long long int* OUTPUT);
+
+int jgrapht_graph_metrics_tracker_vertices(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, long long int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, 
+    double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_graph_metrics_tracker_clustering(void *, double* OUTPUT, double* OUTPUT);
+
 // graph path 
 
 int jgrapht_graphpath_get_fields(void *, double* OUTPUT, int* OUTPUT, int* OUTPUT, void** OUTPUT);
@@ -449,6 +970,8 @@ int jgrapht_graph_test_is_k5_subdivision(void *, int* OUTPUT);
 
 int jgrapht_handles_destroy(void *);
 
+int jgrapht_handles_destroy_batch(long long int *IN_ARRAY, int IN_ARRAY_SIZE);
+
 int jgrapht_handles_get_ccharpointer(void *, char** OUTPUT);
 
 // importers
@@ -489,6 +1012,18 @@ int jgrapht_import_file_graph6sparse6(void *, char*, void *LONG_TO_FUNCTION_POIN
 
 int jgrapht_import_string_graph6sparse6(void *, char*, void *LONG_TO_FUNCTION_POINTER, void *LONG_TO_FUNCTION_POINTER, void *LONG_TO_FUNCTION_POINTER);
 
+int jgrapht_import_file_binary(char*, void** OUTPUT);
+
+int jgrapht_import_edgelist_stream_create(int, int, char*, void** OUTPUT);
+
+int jgrapht_import_edgelist_stream_destroy(void *);
+
+int jgrapht_import_edgelist_stream_push(void *, char *IN_BUFFER, int IN_BUFFER_SIZE);
+
+int jgrapht_import_edgelist_stream_push_edges(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int *IN_ARRAY, int IN_ARRAY_SIZE, double *IN_ARRAY, int IN_ARRAY_SIZE);
+
+int jgrapht_import_edgelist_stream_finish(void *, int, void** OUTPUT);
+
 // isomorphism
 
 int jgrapht_isomorphism_exec_vf2(void *, void *, int* OUTPUT, void** OUTPUT);
@@ -509,6 +1044,26 @@ int jgrapht_it_next_object(void *, void** OUTPUT);
 
 int jgrapht_it_hasnext(void *, int* OUTPUT);
 
+int jgrapht_it_next_int_array(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
+int jgrapht_it_next_double_array(void *, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
+enum iterator_source_t { 
+    ITERATOR_SOURCE_VERTICES = 0,
+    ITERATOR_SOURCE_EDGES,
+    ITERATOR_SOURCE_EDGES_OF,
+    ITERATOR_SOURCE_OUT_EDGES_OF,
+    ITERATOR_SOURCE_IN_EDGES_OF,
+};
+
+int jgrapht_it_pool_create(void** OUTPUT);
+
+int jgrapht_it_pool_reset(void *, void *, int, int);
+
+int jgrapht_it_pool_next_int_array(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
+int jgrapht_it_pool_destroy(void *);
+
 // list
 
 int jgrapht_list_create(void** OUTPUT);
@@ -563,6 +1118,10 @@ int jgrapht_map_int_int_remove(void *, int, int* OUTPUT);
 
 int jgrapht_map_clear(void *);
 
+int jgrapht_map_int_double_to_arrays(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
+int jgrapht_map_int_int_to_arrays(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
 // matching
 
 int jgrapht_matching_exec_greedy_general_max_card(void *, double* OUTPUT, void** OUTPUT);
@@ -597,6 +1156,8 @@ int jgrapht_matching_exec_bipartite_max_weight(void *, double* OUTPUT, void** OU
 
 int jgrapht_mst_exec_kruskal(void *, double* OUTPUT, void** OUTPUT);
 
+int jgrapht_mst_exec_kruskal_edges(void *, double* OUTPUT, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
 int jgrapht_mst_exec_prim(void *, double* OUTPUT, void** OUTPUT);
 
 int jgrapht_mst_exec_boruvka(void *, double* OUTPUT, void** OUTPUT);
@@ -633,6 +1194,18 @@ int jgrapht_scoring_exec_pagerank(void *, void** OUTPUT);
 
 int jgrapht_scoring_exec_custom_pagerank(void *, double, int, double, void** OUTPUT);
 
+int jgrapht_scoring_exec_betweenness_centrality_parallel(void *, int, int, void** OUTPUT);
+
+int jgrapht_scoring_exec_betweenness_centrality_sampled(void *, int, int, long long int, int, void** OUTPUT);
+
+int jgrapht_scoring_exec_closeness_centrality_parallel(void *, int, int, int, void** OUTPUT);
+
+int jgrapht_scoring_exec_harmonic_centrality_parallel(void *, int, int, int, void** OUTPUT);
+
+int jgrapht_scoring_exec_custom_pagerank_warm_start(void *, double, int, double, 
+    int *IN_ARRAY, int IN_ARRAY_SIZE, double *IN_ARRAY, int IN_ARRAY_SIZE, 
+    int *IN_ARRAY, int IN_ARRAY_SIZE, double *IN_ARRAY, int IN_ARRAY_SIZE, void** OUTPUT);
+
 // set
 
 int jgrapht_set_create(void** OUTPUT);
@@ -665,10 +1238,36 @@ int jgrapht_sp_exec_bidirectional_dijkstra_get_path_between_vertices(void *, int
 
 int jgrapht_sp_exec_dijkstra_get_singlesource_from_vertex(void *, int, void** OUTPUT);
 
+int jgrapht_sp_exec_dijkstra_get_paths_between_vertex_pairs(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int *IN_ARRAY, int IN_ARRAY_SIZE, 
+    int, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, void** OUTPUT);
+
+int jgrapht_sp_exec_allpairs_distance_matrix(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_sp_paths_copy(void *, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_sp_paths_destroy(void *);
+
+int jgrapht_sp_index_alt_create(void *, int, void** OUTPUT);
+
+int jgrapht_sp_index_destroy(void *);
+
+int jgrapht_sp_index_query_distance(void *, int, int, double* OUTPUT);
+
+int jgrapht_sp_index_query_path(void *, int, int, double* OUTPUT, int* OUTPUT, void** OUTPUT);
+
+int jgrapht_sp_index_query_distances(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int *IN_ARRAY, int IN_ARRAY_SIZE, 
+    int, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
+int jgrapht_sp_index_dijkstra_get_paths_between_vertex_pairs(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int *IN_ARRAY, int IN_ARRAY_SIZE, 
+    int, double *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, void** OUTPUT);
+
 int jgrapht_sp_exec_bellmanford_get_singlesource_from_vertex(void *, int, void** OUTPUT);
 
 int jgrapht_sp_exec_bfs_get_singlesource_from_vertex(void *, int, void** OUTPUT);
 
+int jgrapht_sp_exec_bfs_multisource(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int, int, 
+    int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE);
+
 int jgrapht_sp_exec_johnson_get_allpairs(void *, void** OUTPUT);
 
 int jgrapht_sp_exec_floydwarshall_get_allpairs(void *, void** OUTPUT);
@@ -695,6 +1294,20 @@ int jgrapht_sp_exec_eppstein_get_k_paths_between_vertices(void *, int, int, int,
 
 int jgrapht_spanner_exec_greedy_multiplicative(void *, int, double* OUTPUT, void** OUTPUT);
 
+// stats
+
+int jgrapht_stats_set_enabled(int);
+
+int jgrapht_stats_is_enabled(int* OUTPUT);
+
+int jgrapht_stats_reset();
+
+int jgrapht_stats_entries_count(int* OUTPUT);
+
+int jgrapht_stats_entry(int, char** OUTPUT, long long* OUTPUT, long long* OUTPUT, long long* OUTPUT, long long* OUTPUT);
+
+int jgrapht_stats_handles(long long* OUTPUT, long long* OUTPUT);
+
 // tour 
 
 int jgrapht_tour_tsp_random(void *, long long int, void** OUTPUT);
@@ -743,6 +1356,15 @@ int jgrapht_traverse_create_closest_first_from_vertex_vit(void *, int, void** OU
 
 int jgrapht_traverse_create_custom_closest_first_from_vertex_vit(void *, int, double, void** OUTPUT);
 
+int jgrapht_traverse_random_walks_create(void *, int *IN_ARRAY, int IN_ARRAY_SIZE, int, int, int, double, double, long long int, int, void** OUTPUT);
+
+int jgrapht_traverse_random_walks_destroy(void *);
+
+int jgrapht_traverse_random_walks_count(void *, long long int* OUTPUT);
+
+int jgrapht_traverse_random_walks_fill(void *, long long int, int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, 
+    int *INPLACE_ARRAY, int INPLACE_ARRAY_SIZE, int* OUTPUT);
+
 // vertex cover
 
 int jgrapht_vertexcover_exec_greedy(void *, double* OUTPUT, void** OUTPUT);
@@ -0,0 +1,763 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// csr snapshot
+
+static unsigned int index_hash(int key) {
+    return ((unsigned int) key) * 2654435761u;
+}
+
+static void index_put(jgrapht_csr_t *csr, int key, int value) {
+    unsigned int i = index_hash(key) & csr->index_mask;
+    while (csr->index_values[i] != -1) {
+        i = (i + 1) & csr->index_mask;
+    }
+    csr->index_keys[i] = key;
+    csr->index_values[i] = value;
+}
+
+int jgrapht_csr_index_of(const jgrapht_csr_t *csr, int vertex) {
+    unsigned int i = index_hash(vertex) & csr->index_mask;
+    while (csr->index_values[i] != -1) {
+        if (csr->index_keys[i] == vertex) {
+            return csr->index_values[i];
+        }
+        i = (i + 1) & csr->index_mask;
+    }
+    return -1;
+}
+
+int jgrapht_csr_indices_of(const jgrapht_csr_t *csr, int *vertices, int size, int *res) {
+    for (int i = 0; i < size; i++) {
+        if ((res[i] = jgrapht_csr_index_of(csr, vertices[i])) == -1) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Vertex not contained in the graph");
+        }
+    }
+    return STATUS_SUCCESS;
+}
+
+static int fill_adjacency(int n, int m, int *offsets, int *tails, int *heads, int *edges, double *weights,
+        int *adj_heads, int *adj_edges, double *adj_weights, int undirected) {
+    int *next = malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (next == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate graph snapshot");
+    }
+    memcpy(next, offsets, sizeof(int) * n);
+    for (int i = 0; i < m; i++) {
+        int p = next[tails[i]]++;
+        adj_heads[p] = heads[i];
+        adj_edges[p] = edges[i];
+        adj_weights[p] = weights[i];
+        if (undirected && tails[i] != heads[i]) {
+            p = next[heads[i]]++;
+            adj_heads[p] = tails[i];
+            adj_edges[p] = edges[i];
+            adj_weights[p] = weights[i];
+        }
+    }
+    free(next);
+    return STATUS_SUCCESS;
+}
+
+static int *count_offsets(int n, int m, int *tails, int *heads, int undirected) {
+    int *offsets = calloc(n + 1, sizeof(int));
+    if (offsets == NULL) {
+        return NULL;
+    }
+    for (int i = 0; i < m; i++) {
+        offsets[tails[i] + 1]++;
+        if (undirected && tails[i] != heads[i]) {
+            offsets[heads[i] + 1]++;
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        offsets[v + 1] += offsets[v];
+    }
+    return offsets;
+}
+
+int jgrapht_csr_create(void *g, jgrapht_csr_t** res) {
+    int status, n, m, count;
+    jgrapht_csr_t *csr = calloc(1, sizeof(jgrapht_csr_t));
+    if (csr == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate graph snapshot");
+    }
+    int *edges = NULL, *sources = NULL, *targets = NULL;
+    double *weights = NULL;
+
+    if ((status = jgrapht_graph_is_directed(g, &csr->directed)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_is_weighted(g, &csr->weighted)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_vertices_count(g, &n)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_edges_count(g, &m)) != STATUS_SUCCESS) {
+        free(csr);
+        return status;
+    }
+
+    int capacity = 2;
+    while (capacity < 2 * n) {
+        capacity <<= 1;
+    }
+    csr->index_mask = capacity - 1;
+    csr->vertices = malloc(sizeof(int) * (n > 0 ? n : 1));
+    csr->index_keys = malloc(sizeof(int) * capacity);
+    csr->index_values = malloc(sizeof(int) * capacity);
+    edges = malloc(sizeof(int) * (m > 0 ? m : 1));
+    sources = malloc(sizeof(int) * (m > 0 ? m : 1));
+    targets = malloc(sizeof(int) * (m > 0 ? m : 1));
+    weights = malloc(sizeof(double) * (m > 0 ? m : 1));
+    if (csr->vertices == NULL || csr->index_keys == NULL || csr->index_values == NULL
+            || edges == NULL || sources == NULL || targets == NULL || weights == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate graph snapshot");
+        goto cleanup;
+    }
+    memset(csr->index_values, -1, sizeof(int) * capacity);
+
+    if ((status = jgrapht_graph_vertices_array(g, csr->vertices, n, &count)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+    csr->n = n = count;
+    for (int v = 0; v < n; v++) {
+        index_put(csr, csr->vertices[v], v);
+    }
+
+    if ((status = jgrapht_graph_edges_array(g, edges, m, &count)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_edges_endpoints_array(g, edges, count, sources, count, targets, count, weights, count)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+    csr->m = m = count;
+    for (int i = 0; i < m; i++) {
+        sources[i] = jgrapht_csr_index_of(csr, sources[i]);
+        targets[i] = jgrapht_csr_index_of(csr, targets[i]);
+        if (weights[i] < 0.0) {
+            csr->negative_weights = 1;
+        }
+    }
+
+    int undirected = !csr->directed;
+    csr->out_offsets = count_offsets(n, m, sources, targets, undirected);
+    int arcs = csr->out_offsets != NULL ? csr->out_offsets[n] : 0;
+    csr->out_targets = malloc(sizeof(int) * (arcs > 0 ? arcs : 1));
+    csr->out_edges = malloc(sizeof(int) * (arcs > 0 ? arcs : 1));
+    csr->out_weights = malloc(sizeof(double) * (arcs > 0 ? arcs : 1));
+    if (csr->out_offsets == NULL || csr->out_targets == NULL || csr->out_edges == NULL || csr->out_weights == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate graph snapshot");
+        goto cleanup;
+    }
+    if ((status = fill_adjacency(n, m, csr->out_offsets, sources, targets, edges, weights,
+            csr->out_targets, csr->out_edges, csr->out_weights, undirected)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+
+    if (undirected) {
+        csr->in_offsets = csr->out_offsets;
+        csr->in_sources = csr->out_targets;
+        csr->in_edges = csr->out_edges;
+        csr->in_weights = csr->out_weights;
+    } else {
+        csr->in_offsets = count_offsets(n, m, targets, sources, 0);
+        csr->in_sources = malloc(sizeof(int) * (m > 0 ? m : 1));
+        csr->in_edges = malloc(sizeof(int) * (m > 0 ? m : 1));
+        csr->in_weights = malloc(sizeof(double) * (m > 0 ? m : 1));
+        if (csr->in_offsets == NULL || csr->in_sources == NULL || csr->in_edges == NULL || csr->in_weights == NULL) {
+            status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate graph snapshot");
+            goto cleanup;
+        }
+        status = fill_adjacency(n, m, csr->in_offsets, targets, sources, edges, weights,
+            csr->in_sources, csr->in_edges, csr->in_weights, 0);
+    }
+
+cleanup:
+    free(edges);
+    free(sources);
+    free(targets);
+    free(weights);
+    if (status != STATUS_SUCCESS) {
+        jgrapht_csr_destroy(csr);
+        return status;
+    }
+    *res = csr;
+    return STATUS_SUCCESS;
+}
+
+void jgrapht_csr_destroy(jgrapht_csr_t *csr) {
+    if (csr == NULL) {
+        return;
+    }
+    if (csr->in_offsets != csr->out_offsets) {
+        free(csr->in_offsets);
+        free(csr->in_sources);
+        free(csr->in_edges);
+        free(csr->in_weights);
+    }
+    free(csr->out_offsets);
+    free(csr->out_targets);
+    free(csr->out_edges);
+    free(csr->out_weights);
+    free(csr->vertices);
+    free(csr->index_keys);
+    free(csr->index_values);
+    free(csr);
+}
+
+int jgrapht_csr_scores_to_map(const jgrapht_csr_t *csr, const double *scores, void** res) {
+    void *map;
+    int status;
+    if ((status = jgrapht_map_linked_create(&map)) != STATUS_SUCCESS) {
+        return status;
+    }
+    for (int v = 0; v < csr->n; v++) {
+        if ((status = jgrapht_map_int_double_put(map, csr->vertices[v], scores[v])) != STATUS_SUCCESS) {
+            jgrapht_handles_destroy(map);
+            return status;
+        }
+    }
+    *res = map;
+    return STATUS_SUCCESS;
+}
+
+// compact copy of a graph, vertices and edges are renumbered from 0 and the
+// adjacency of each vertex is sorted by target
+
+typedef struct {
+    int target;
+    int edge;
+    double weight;
+} csr_arc_t;
+
+static int compare_arc(const void *a, const void *b) {
+    const csr_arc_t *x = (const csr_arc_t *) a, *y = (const csr_arc_t *) b;
+    if (x->target != y->target) {
+        return (x->target > y->target) - (x->target < y->target);
+    }
+    return (x->edge > y->edge) - (x->edge < y->edge);
+}
+
+static __thread const int *degree_order_degrees;
+
+// larger degree first, ties by position
+static int compare_degree(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    int dx = degree_order_degrees[x], dy = degree_order_degrees[y];
+    if (dx != dy) {
+        return (dx < dy) - (dx > dy);
+    }
+    return (x > y) - (x < y);
+}
+
+// Copies the graph into caller provided arrays. Vertex i of the copy is
+// vertices[i] of the graph and its arcs are at positions offsets[i] to
+// offsets[i+1] of targets, edges and weights. Undirected edges are stored in
+// the adjacency of both endpoints. Edges are numbered by their first arc and
+// edge j of the copy is original_edges[j] of the graph. No sparse graph is
+// created, see jgrapht_graph_sparse_create_from_csr.
+int jgrapht_graph_csr_create(void *g, int sort_by_degree, int *vertices, int vertices_size,
+        int *offsets, int offsets_size, int *targets, int targets_size, int *edges, int edges_size,
+        double *weights, int weights_size, int *original_edges, int original_edges_size, int* arcs_res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = csr->n, m = csr->m, arcs = csr->out_offsets[n];
+    if (vertices_size < n || offsets_size < n + 1 || targets_size < arcs || edges_size < arcs
+            || (weights != NULL && weights_size < arcs) || original_edges_size < m) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Arrays smaller than the graph");
+    }
+
+    int capacity = 2;
+    while (capacity < 2 * m) {
+        capacity <<= 1;
+    }
+    int *order = malloc(sizeof(int) * (n > 0 ? n : 1));
+    int *rank = malloc(sizeof(int) * (n > 0 ? n : 1));
+    int *degree = malloc(sizeof(int) * (n > 0 ? n : 1));
+    csr_arc_t *row = malloc(sizeof(csr_arc_t) * (arcs > 0 ? arcs : 1));
+    int *edge_keys = malloc(sizeof(int) * capacity);
+    int *edge_values = malloc(sizeof(int) * capacity);
+    if (order == NULL || rank == NULL || degree == NULL || row == NULL || edge_keys == NULL
+            || edge_values == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate graph snapshot");
+        goto cleanup;
+    }
+
+    for (int v = 0; v < n; v++) {
+        order[v] = v;
+        degree[v] = csr->out_offsets[v + 1] - csr->out_offsets[v];
+        if (csr->directed) {
+            degree[v] += csr->in_offsets[v + 1] - csr->in_offsets[v];
+        }
+    }
+    if (sort_by_degree) {
+        degree_order_degrees = degree;
+        qsort(order, n, sizeof(int), compare_degree);
+    }
+    for (int i = 0; i < n; i++) {
+        rank[order[i]] = i;
+        vertices[i] = csr->vertices[order[i]];
+    }
+
+    // edges are numbered when their first arc is reached
+    memset(edge_values, -1, sizeof(int) * capacity);
+    int next_edge = 0;
+    offsets[0] = 0;
+    for (int i = 0; i < n; i++) {
+        int v = order[i];
+        int begin = offsets[i];
+        int degree_v = csr->out_offsets[v + 1] - csr->out_offsets[v];
+        for (int k = 0; k < degree_v; k++) {
+            int arc = csr->out_offsets[v] + k;
+            row[k].target = rank[csr->out_targets[arc]];
+            row[k].edge = csr->out_edges[arc];
+            row[k].weight = csr->out_weights[arc];
+        }
+        qsort(row, degree_v, sizeof(csr_arc_t), compare_arc);
+        for (int k = 0; k < degree_v; k++) {
+            unsigned int h = index_hash(row[k].edge) & (capacity - 1);
+            while (edge_values[h] != -1 && edge_keys[h] != row[k].edge) {
+                h = (h + 1) & (capacity - 1);
+            }
+            if (edge_values[h] == -1) {
+                edge_keys[h] = row[k].edge;
+                edge_values[h] = next_edge;
+                original_edges[next_edge] = row[k].edge;
+                next_edge++;
+            }
+            targets[begin + k] = row[k].target;
+            edges[begin + k] = edge_values[h];
+            if (weights != NULL) {
+                weights[begin + k] = row[k].weight;
+            }
+        }
+        offsets[i + 1] = begin + degree_v;
+    }
+
+    *arcs_res = arcs;
+    status = STATUS_SUCCESS;
+
+cleanup:
+    free(order);
+    free(rank);
+    free(degree);
+    free(row);
+    free(edge_keys);
+    free(edge_values);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
+
+// Creates a sparse graph from arrays in the layout of jgrapht_graph_csr_create.
+// Edge e is read from its first arc, which is the first arc of the arrays
+// whose edge is e since edges are numbered in the order of their first arc.
+// Weights may be NULL for an unweighted graph.
+int jgrapht_graph_sparse_create_from_csr(int directed, int *offsets, int offsets_size, int *targets, int targets_size,
+        int *edges, int edges_size, double *weights, int weights_size, void** res) {
+    int n = offsets_size - 1;
+    if (n < 0 || offsets[0] != 0) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Invalid offsets");
+    }
+    for (int v = 0; v < n; v++) {
+        if (offsets[v + 1] < offsets[v]) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Invalid offsets");
+        }
+    }
+    int arcs = offsets[n];
+    if (targets_size < arcs || edges_size < arcs || (weights != NULL && weights_size < arcs)) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Arrays smaller than the offsets");
+    }
+
+    int *sources = malloc(sizeof(int) * (arcs > 0 ? arcs : 1));
+    int *heads = malloc(sizeof(int) * (arcs > 0 ? arcs : 1));
+    double *edge_weights = weights != NULL ? malloc(sizeof(double) * (arcs > 0 ? arcs : 1)) : NULL;
+    int status;
+    if (sources == NULL || heads == NULL || (weights != NULL && edge_weights == NULL)) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate graph snapshot");
+        goto cleanup;
+    }
+
+    int m = 0;
+    for (int v = 0; v < n; v++) {
+        for (int arc = offsets[v]; arc < offsets[v + 1]; arc++) {
+            if (targets[arc] < 0 || targets[arc] >= n || edges[arc] < 0 || edges[arc] > m) {
+                status = jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Invalid arc");
+                goto cleanup;
+            }
+            if (edges[arc] == m) {
+                sources[m] = v;
+                heads[m] = targets[arc];
+                if (weights != NULL) {
+                    edge_weights[m] = weights[arc];
+                }
+                m++;
+            }
+        }
+    }
+
+    status = jgrapht_graph_sparse_create_from_arrays(directed, weights != NULL, n, sources, m, heads, m,
+        edge_weights, weights != NULL ? m : 0, res);
+
+cleanup:
+    free(sources);
+    free(heads);
+    free(edge_weights);
+    return status;
+}
+
+// single source shortest paths
+
+jgrapht_csr_sssp_t *jgrapht_csr_sssp_create(const jgrapht_csr_t *csr) {
+    jgrapht_csr_sssp_t *ws = calloc(1, sizeof(jgrapht_csr_sssp_t));
+    if (ws == NULL) {
+        return NULL;
+    }
+    int n = csr->n > 0 ? csr->n : 1;
+    int arcs = csr->out_offsets[csr->n] + 1;
+    ws->n = csr->n;
+    ws->dist = malloc(sizeof(double) * n);
+    ws->sigma = malloc(sizeof(double) * n);
+    ws->pred = malloc(sizeof(int) * n);
+    ws->pred_arc = malloc(sizeof(int) * n);
+    ws->order = malloc(sizeof(int) * n);
+    ws->touched = malloc(sizeof(int) * n);
+    ws->heap_vertices = malloc(sizeof(int) * arcs);
+    ws->heap_keys = malloc(sizeof(double) * arcs);
+    ws->heap_capacity = arcs;
+    if (ws->dist == NULL || ws->sigma == NULL || ws->pred == NULL || ws->pred_arc == NULL || ws->order == NULL
+            || ws->touched == NULL || ws->heap_vertices == NULL || ws->heap_keys == NULL) {
+        jgrapht_csr_sssp_destroy(ws);
+        return NULL;
+    }
+    for (int v = 0; v < csr->n; v++) {
+        ws->dist[v] = INFINITY;
+        ws->sigma[v] = 0.0;
+        ws->pred[v] = -1;
+        ws->pred_arc[v] = -1;
+    }
+    return ws;
+}
+
+void jgrapht_csr_sssp_destroy(jgrapht_csr_sssp_t *ws) {
+    if (ws == NULL) {
+        return;
+    }
+    free(ws->dist);
+    free(ws->sigma);
+    free(ws->pred);
+    free(ws->pred_arc);
+    free(ws->order);
+    free(ws->touched);
+    free(ws->heap_vertices);
+    free(ws->heap_keys);
+    free(ws->potential);
+    free(ws);
+}
+
+static int heap_push(jgrapht_csr_sssp_t *ws, int v, double key) {
+    if (ws->heap_size == ws->heap_capacity) {
+        // only searches which reopen vertices push more than one entry per arc
+        int capacity = 2 * ws->heap_capacity;
+        int *vertices = realloc(ws->heap_vertices, sizeof(int) * capacity);
+        if (vertices == NULL) {
+            return -1;
+        }
+        ws->heap_vertices = vertices;
+        double *keys = realloc(ws->heap_keys, sizeof(double) * capacity);
+        if (keys == NULL) {
+            return -1;
+        }
+        ws->heap_keys = keys;
+        ws->heap_capacity = capacity;
+    }
+    int i = ws->heap_size++;
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (ws->heap_keys[parent] <= key) {
+            break;
+        }
+        ws->heap_vertices[i] = ws->heap_vertices[parent];
+        ws->heap_keys[i] = ws->heap_keys[parent];
+        i = parent;
+    }
+    ws->heap_vertices[i] = v;
+    ws->heap_keys[i] = key;
+    return 0;
+}
+
+static int heap_pop(jgrapht_csr_sssp_t *ws, double *key) {
+    int top = ws->heap_vertices[0];
+    *key = ws->heap_keys[0];
+    int size = --ws->heap_size;
+    int v = ws->heap_vertices[size];
+    double k = ws->heap_keys[size];
+    int i = 0;
+    while (1) {
+        int child = 2 * i + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && ws->heap_keys[child + 1] < ws->heap_keys[child]) {
+            child++;
+        }
+        if (k <= ws->heap_keys[child]) {
+            break;
+        }
+        ws->heap_vertices[i] = ws->heap_vertices[child];
+        ws->heap_keys[i] = ws->heap_keys[child];
+        i = child;
+    }
+    if (size > 0) {
+        ws->heap_vertices[i] = v;
+        ws->heap_keys[i] = k;
+    }
+    return top;
+}
+
+static void sssp_touch(jgrapht_csr_sssp_t *ws, int v) {
+    if (ws->dist[v] == INFINITY) {
+        ws->touched[ws->touched_count++] = v;
+    }
+}
+
+// Computes distances, number of shortest paths and a shortest path tree from
+// source. Vertices are settled in non-decreasing distance order which is
+// recorded in order. If target is not -1 the search stops once the target is
+// settled. If reverse is true, edges are traversed backwards.
+static void sssp_reset(jgrapht_csr_sssp_t *ws) {
+    for (int i = 0; i < ws->touched_count; i++) {
+        int v = ws->touched[i];
+        ws->dist[v] = INFINITY;
+        ws->sigma[v] = 0.0;
+        ws->pred[v] = -1;
+        ws->pred_arc[v] = -1;
+    }
+    ws->touched_count = 0;
+    ws->settled = 0;
+    ws->heap_size = 0;
+    ws->failed = 0;
+}
+
+void jgrapht_csr_sssp_run(const jgrapht_csr_t *csr, jgrapht_csr_sssp_t *ws, int source, int target, int reverse) {
+    sssp_reset(ws);
+
+    const int *offsets = reverse ? csr->in_offsets : csr->out_offsets;
+    const int *heads = reverse ? csr->in_sources : csr->out_targets;
+    const double *weights = reverse ? csr->in_weights : csr->out_weights;
+
+    sssp_touch(ws, source);
+    ws->dist[source] = 0.0;
+    ws->sigma[source] = 1.0;
+
+    if (!csr->weighted) {
+        // the order array doubles as the fifo queue
+        ws->order[ws->settled++] = source;
+        for (int head = 0; head < ws->settled; head++) {
+            int v = ws->order[head];
+            if (v == target) {
+                ws->settled = head + 1;
+                return;
+            }
+            double d = ws->dist[v] + 1.0;
+            for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+                int w = heads[a];
+                if (ws->dist[w] == INFINITY) {
+                    sssp_touch(ws, w);
+                    ws->dist[w] = d;
+                    ws->pred[w] = v;
+                    ws->pred_arc[w] = a;
+                    ws->order[ws->settled++] = w;
+                }
+                if (ws->dist[w] == d) {
+                    ws->sigma[w] += ws->sigma[v];
+                }
+            }
+        }
+        return;
+    }
+
+    heap_push(ws, source, 0.0);
+    while (ws->heap_size > 0) {
+        double d;
+        int v = heap_pop(ws, &d);
+        if (d > ws->dist[v]) {
+            // stale entry
+            continue;
+        }
+        ws->order[ws->settled++] = v;
+        if (v == target) {
+            return;
+        }
+        for (int a = offsets[v]; a < offsets[v + 1]; a++) {
+            int w = heads[a];
+            double nd = d + weights[a];
+            if (nd < ws->dist[w]) {
+                sssp_touch(ws, w);
+                ws->dist[w] = nd;
+                ws->sigma[w] = ws->sigma[v];
+                ws->pred[w] = v;
+                ws->pred_arc[w] = a;
+                heap_push(ws, w, nd);
+            } else if (nd == ws->dist[w]) {
+                ws->sigma[w] += ws->sigma[v];
+            }
+        }
+    }
+}
+
+// A* search from source to target. The heuristic must never overestimate the
+// distance to the target, vertices are reopened if it is not consistent. The
+// search fails, leaving failed set, only if the heap cannot grow. Only the
+// distances and the shortest path tree are maintained, settled counts the
+// number of expanded vertices.
+void jgrapht_csr_sssp_run_astar(const jgrapht_csr_t *csr, jgrapht_csr_sssp_t *ws, int source, int target,
+        jgrapht_csr_heuristic_t heuristic, void *ctx) {
+    sssp_reset(ws);
+    if (ws->potential == NULL && (ws->potential = malloc(sizeof(double) * (ws->n > 0 ? ws->n : 1))) == NULL) {
+        ws->failed = 1;
+        return;
+    }
+
+    sssp_touch(ws, source);
+    ws->dist[source] = 0.0;
+    ws->potential[source] = heuristic(ctx, source, target);
+    heap_push(ws, source, ws->potential[source]);
+    while (ws->heap_size > 0) {
+        double f;
+        int v = heap_pop(ws, &f);
+        if (f > ws->dist[v] + ws->potential[v]) {
+            // stale entry
+            continue;
+        }
+        ws->settled++;
+        if (v == target) {
+            return;
+        }
+        for (int a = csr->out_offsets[v]; a < csr->out_offsets[v + 1]; a++) {
+            int w = csr->out_targets[a];
+            double nd = ws->dist[v] + (csr->weighted ? csr->out_weights[a] : 1.0);
+            if (nd < ws->dist[w]) {
+                if (ws->dist[w] == INFINITY) {
+                    sssp_touch(ws, w);
+                    ws->potential[w] = heuristic(ctx, w, target);
+                }
+                ws->dist[w] = nd;
+                ws->pred[w] = v;
+                ws->pred_arc[w] = a;
+                if (heap_push(ws, w, nd + ws->potential[w]) != 0) {
+                    ws->failed = 1;
+                    return;
+                }
+            }
+        }
+    }
+}
+
+// Writes the edges of the shortest path tree from the source to target into
+// edges, in path order, and returns the number of edges. When edges is NULL
+// only the number of edges is returned.
+int jgrapht_csr_sssp_path(const jgrapht_csr_t *csr, const jgrapht_csr_sssp_t *ws, int target, int reverse, int *edges) {
+    const int *arc_edges = reverse ? csr->in_edges : csr->out_edges;
+    int count = 0;
+    for (int v = target; ws->pred[v] != -1; v = ws->pred[v]) {
+        count++;
+    }
+    if (edges != NULL) {
+        int i = count;
+        for (int v = target; ws->pred[v] != -1; v = ws->pred[v]) {
+            edges[--i] = arc_edges[ws->pred_arc[v]];
+        }
+    }
+    return count;
+}
+
+// random numbers
+
+unsigned long long jgrapht_random_next(unsigned long long *state) {
+    unsigned long long z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// uniform in [0, bound)
+int jgrapht_random_int(unsigned long long *state, int bound) {
+    return (int) (((jgrapht_random_next(state) >> 32) * (unsigned long long) bound) >> 32);
+}
+
+// uniform in [0, 1)
+double jgrapht_random_double(unsigned long long *state) {
+    return (jgrapht_random_next(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// parallel loops
+
+int jgrapht_parallel_threads(int threads) {
+    if (threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? (int) cpus : 1;
+    }
+    return threads;
+}
+
+typedef struct {
+    int items;
+    int chunk;
+    int next;
+    jgrapht_parallel_body_t body;
+    void *ctx;
+} parallel_loop_t;
+
+typedef struct {
+    parallel_loop_t *loop;
+    int worker;
+} parallel_worker_t;
+
+static void *parallel_worker(void *arg) {
+    parallel_worker_t *w = (parallel_worker_t *) arg;
+    parallel_loop_t *loop = w->loop;
+    int begin;
+    // idle workers grab the next chunk of items from the shared counter
+    while ((begin = __atomic_fetch_add(&loop->next, loop->chunk, __ATOMIC_RELAXED)) < loop->items) {
+        int end = begin + loop->chunk < loop->items ? begin + loop->chunk : loop->items;
+        for (int i = begin; i < end; i++) {
+            loop->body(loop->ctx, w->worker, i);
+        }
+    }
+    return NULL;
+}
+
+// Runs body(ctx, worker, item) for every item in [0, items) using the given
+// number of workers. The calling thread participates as worker 0. Bodies must
+// not call into the isolate.
+void jgrapht_parallel_for(int items, int threads, int chunk, jgrapht_parallel_body_t body, void *ctx) {
+    parallel_loop_t loop = { items, chunk > 0 ? chunk : 1, 0, body, ctx };
+    if (threads < 1) {
+        threads = 1;
+    }
+    pthread_t *ids = malloc(sizeof(pthread_t) * threads);
+    parallel_worker_t *workers = malloc(sizeof(parallel_worker_t) * threads);
+    int started = 0;
+    if (ids != NULL && workers != NULL) {
+        for (int i = 1; i < threads; i++) {
+            workers[i].loop = &loop;
+            workers[i].worker = i;
+            if (pthread_create(&ids[i], NULL, parallel_worker, &workers[i]) != 0) {
+                // remaining items are picked up by the running workers
+                break;
+            }
+            started = i;
+        }
+    }
+    parallel_worker_t self = { &loop, 0 };
+    parallel_worker(&self);
+    for (int i = 1; i <= started; i++) {
+        pthread_join(ids[i], NULL);
+    }
+    free(ids);
+    free(workers);
+}
@@ -0,0 +1,129 @@
+#ifndef __BACKEND_CSR_H
+#define __BACKEND_CSR_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+// Immutable compressed sparse row snapshot of a graph. Vertices are addressed
+// by their position in the vertex iteration order of the graph. Undirected
+// graphs store each edge in the adjacency of both endpoints and share the
+// incoming adjacency with the outgoing one.
+
+typedef struct {
+    int n;
+    int m;
+    int directed;
+    int weighted;
+    int negative_weights;
+    int *vertices;
+    int *out_offsets;
+    int *out_targets;
+    int *out_edges;
+    double *out_weights;
+    int *in_offsets;
+    int *in_sources;
+    int *in_edges;
+    double *in_weights;
+    int index_mask;
+    int *index_keys;
+    int *index_values;
+} jgrapht_csr_t;
+
+int jgrapht_csr_create(void *, jgrapht_csr_t**);
+
+void jgrapht_csr_destroy(jgrapht_csr_t *);
+
+int jgrapht_csr_index_of(const jgrapht_csr_t *, int);
+
+int jgrapht_csr_indices_of(const jgrapht_csr_t *, int *, int, int *);
+
+int jgrapht_csr_scores_to_map(const jgrapht_csr_t *, const double *, void**);
+
+// single source shortest paths on a snapshot, breadth first for unweighted
+// graphs and dijkstra otherwise
+
+typedef struct {
+    int n;
+    double *dist;
+    double *sigma;
+    int *pred;
+    int *pred_arc;
+    int *order;
+    int settled;
+    int *touched;
+    int touched_count;
+    int *heap_vertices;
+    double *heap_keys;
+    int heap_size;
+    int heap_capacity;
+    double *potential;
+    int failed;
+} jgrapht_csr_sssp_t;
+
+jgrapht_csr_sssp_t *jgrapht_csr_sssp_create(const jgrapht_csr_t *);
+
+void jgrapht_csr_sssp_destroy(jgrapht_csr_sssp_t *);
+
+void jgrapht_csr_sssp_run(const jgrapht_csr_t *, jgrapht_csr_sssp_t *, int, int, int);
+
+int jgrapht_csr_sssp_path(const jgrapht_csr_t *, const jgrapht_csr_sssp_t *, int, int, int *);
+
+// lower bound on the distance between two vertices
+typedef double (*jgrapht_csr_heuristic_t)(void *, int, int);
+
+void jgrapht_csr_sssp_run_astar(const jgrapht_csr_t *, jgrapht_csr_sssp_t *, int, int, jgrapht_csr_heuristic_t, void *);
+
+// random numbers, splitmix64
+
+unsigned long long jgrapht_random_next(unsigned long long *);
+
+int jgrapht_random_int(unsigned long long *, int);
+
+double jgrapht_random_double(unsigned long long *);
+
+// parallel loops
+
+typedef void (*jgrapht_parallel_body_t)(void *, int, int);
+
+int jgrapht_parallel_threads(int);
+
+void jgrapht_parallel_for(int, int, int, jgrapht_parallel_body_t, void *);
+
+// listeners of graph modifications, the graph functions of the backend report
+// every successful change, changes made inside the isolate and the views
+// created from each graph
+
+void jgrapht_graph_listeners_vertex_added(void *, int);
+
+void jgrapht_graph_listeners_vertex_removed(void *, int);
+
+void jgrapht_graph_listeners_edge_added(void *, int, int, int);
+
+void jgrapht_graph_listeners_edge_removed(void *, int);
+
+void jgrapht_graph_listeners_changed(void *);
+
+void jgrapht_graph_listeners_view_created(void *, void *);
+
+void jgrapht_graph_listeners_view_destroyed(void *);
+
+// edge weights of weighted views, the get and set functions return whether
+// the graph is a weighted view and only then store a status
+
+int jgrapht_weights_overlay_is_active(void *);
+
+int jgrapht_weights_overlay_get(void *, int *, int, double *, int *);
+
+int jgrapht_weights_overlay_set(void *, int *, int, double *, int *);
+
+void jgrapht_weights_overlay_remove(void *);
+
+// handles destroyed by the backend on behalf of python, see backend_stats.c
+
+void jgrapht_stats_handle_destroyed(void *);
+
+#if defined(__cplusplus)
+}
+#endif
+#endif
@@ -0,0 +1,954 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Enumeration of maximal cliques and simple cycles on a csr snapshot of the
+// graph. Both algorithms keep their recursion on an explicit stack, which lets
+// them stop as soon as a batch of results is full and continue later from the
+// same point. Results are therefore produced on demand.
+//
+// Cliques can also be enumerated by several workers. Every vertex of the
+// degeneracy ordering roots an independent subproblem, idle workers take the
+// next root from a shared counter and keep their results in a private batch
+// until they are merged into the batch returned to the caller.
+
+// sorted adjacency without duplicates, by vertex position
+typedef struct {
+    int n;
+    int *offsets;
+    int *adj;
+} enum_graph_t;
+
+// results of the last batch, flattened with offsets
+typedef struct {
+    int count;
+    int *offsets;
+    int offsets_capacity;
+    int *members;
+    int members_size;
+    int members_capacity;
+} enum_batch_t;
+
+typedef struct {
+    int *p;
+    int np;
+    int *x;
+    int nx;
+    int *cand;
+    int ncand;
+    int next;
+} bk_frame_t;
+
+typedef struct {
+    const enum_graph_t *graph;
+    int min_size;
+    int depth;
+    bk_frame_t *stack;
+    int *r;
+} bk_state_t;
+
+typedef struct {
+    int v;
+    int next;
+    int found;
+} johnson_frame_t;
+
+typedef struct {
+    const enum_graph_t *graph;
+    const int *component;
+    int min_size;
+    int s;
+    int depth;
+    johnson_frame_t *stack;
+    int *path;
+    unsigned char *blocked;
+    int **b;
+    int *b_size;
+    int *b_capacity;
+    int *touched;
+    int touched_count;
+    unsigned char *is_touched;
+    int *unblock_stack;
+} johnson_state_t;
+
+typedef struct {
+    bk_state_t bk;
+    enum_batch_t out;
+    int failed;
+} bk_worker_t;
+
+#define ENUM_CLIQUES 0
+#define ENUM_CYCLES 1
+
+// steps of a worker between two checks of the shared state
+#define ENUM_WORKER_STEPS 1024
+
+typedef struct {
+    int kind;
+    jgrapht_csr_t *csr;
+    enum_graph_t graph;
+    int min_size;
+    long long max_results;
+    long long emitted;
+    int failed;
+    // cliques
+    int *order;
+    int *rank;
+    int next_root;
+    bk_state_t bk;
+    // parallel cliques
+    int threads;
+    bk_worker_t *workers;
+    int next_worker;
+    int limit;
+    int produced;
+    int stop;
+    int finished;
+    long long timeout_ns;
+    long long elapsed_ns;
+    long long deadline_ns;
+    // cycles
+    int *component;
+    johnson_state_t js;
+    enum_batch_t batch;
+} enumeration_t;
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+static int enum_graph_create(const jgrapht_csr_t *csr, int undirected, enum_graph_t *g) {
+    int n = csr->n;
+    g->n = n;
+    g->offsets = (int *) malloc(sizeof(int) * (n + 1));
+    int total = csr->out_offsets[n] + (undirected && csr->directed ? csr->in_offsets[n] : 0);
+    g->adj = (int *) malloc(sizeof(int) * (total + 1));
+    if (g->offsets == NULL || g->adj == NULL) {
+        return 0;
+    }
+    int size = 0;
+    for (int v = 0; v < n; v++) {
+        int begin = size;
+        for (int k = csr->out_offsets[v]; k < csr->out_offsets[v + 1]; k++) {
+            if (!undirected || csr->out_targets[k] != v) {
+                g->adj[size++] = csr->out_targets[k];
+            }
+        }
+        if (undirected && csr->directed) {
+            for (int k = csr->in_offsets[v]; k < csr->in_offsets[v + 1]; k++) {
+                if (csr->in_sources[k] != v) {
+                    g->adj[size++] = csr->in_sources[k];
+                }
+            }
+        }
+        qsort(g->adj + begin, size - begin, sizeof(int), compare_int);
+        int unique = begin;
+        for (int k = begin; k < size; k++) {
+            if (k == begin || g->adj[k] != g->adj[unique - 1]) {
+                g->adj[unique++] = g->adj[k];
+            }
+        }
+        g->offsets[v] = begin;
+        size = unique;
+    }
+    g->offsets[n] = size;
+    return 1;
+}
+
+static void enum_graph_destroy(enum_graph_t *g) {
+    free(g->offsets);
+    free(g->adj);
+}
+
+static int batch_add(enum_batch_t *b, const int *vertices, const int *members, int size) {
+    if (b->count + 2 > b->offsets_capacity) {
+        int capacity = b->offsets_capacity > 0 ? 2 * b->offsets_capacity : 64;
+        int *offsets = (int *) realloc(b->offsets, sizeof(int) * capacity);
+        if (offsets == NULL) {
+            return 0;
+        }
+        b->offsets = offsets;
+        b->offsets_capacity = capacity;
+    }
+    if (b->members_size + size > b->members_capacity) {
+        int capacity = b->members_capacity > 0 ? b->members_capacity : 256;
+        while (capacity < b->members_size + size) {
+            capacity *= 2;
+        }
+        int *m = (int *) realloc(b->members, sizeof(int) * capacity);
+        if (m == NULL) {
+            return 0;
+        }
+        b->members = m;
+        b->members_capacity = capacity;
+    }
+    b->offsets[b->count] = b->members_size;
+    for (int i = 0; i < size; i++) {
+        b->members[b->members_size++] = vertices != NULL ? vertices[members[i]] : members[i];
+    }
+    b->count++;
+    b->offsets[b->count] = b->members_size;
+    return 1;
+}
+
+// sorted set operations
+
+static int intersect(const int *a, int na, const int *b, int nb, int *res) {
+    int i = 0, j = 0, size = 0;
+    while (i < na && j < nb) {
+        if (a[i] < b[j]) {
+            i++;
+        } else if (a[i] > b[j]) {
+            j++;
+        } else {
+            if (res != NULL) {
+                res[size] = a[i];
+            }
+            size++;
+            i++;
+            j++;
+        }
+    }
+    return size;
+}
+
+static int difference(const int *a, int na, const int *b, int nb, int *res) {
+    int i = 0, j = 0, size = 0;
+    while (i < na) {
+        if (j == nb || a[i] < b[j]) {
+            res[size++] = a[i++];
+        } else if (a[i] > b[j]) {
+            j++;
+        } else {
+            i++;
+            j++;
+        }
+    }
+    return size;
+}
+
+// Bron-Kerbosch with pivoting, started from a vertex of a degeneracy ordering
+
+// removes the first k results of a batch
+static void batch_drop_front(enum_batch_t *b, int k) {
+    if (k == 0) {
+        return;
+    }
+    int base = b->offsets[k];
+    memmove(b->members, b->members + base, sizeof(int) * (b->members_size - base));
+    b->members_size -= base;
+    b->count -= k;
+    for (int i = 0; i <= b->count; i++) {
+        b->offsets[i] = b->offsets[i + k] - base;
+    }
+}
+
+static void bk_free_frame(bk_frame_t *f) {
+    free(f->p);
+    free(f->x);
+    free(f->cand);
+}
+
+// enter the recursion with R = r[0..rsize), takes ownership of p and x
+static int bk_enter(bk_state_t *st, enum_batch_t *out, const int *vertices, int *p, int np, int *x, int nx, int x_capacity, int rsize) {
+    const enum_graph_t *g = st->graph;
+    if (np == 0) {
+        int ok = 1;
+        if (nx == 0 && rsize >= st->min_size) {
+            ok = batch_add(out, vertices, st->r, rsize);
+        }
+        free(p);
+        free(x);
+        return ok;
+    }
+    if (rsize + np < st->min_size) {
+        // no maximal clique of at least the minimum size below
+        free(p);
+        free(x);
+        return 1;
+    }
+
+    // the pivot maximizes the number of candidates it covers
+    int pivot = -1, best = -1;
+    for (int k = 0; k < np + nx; k++) {
+        int u = k < np ? p[k] : x[k - np];
+        int covered = intersect(p, np, g->adj + g->offsets[u], g->offsets[u + 1] - g->offsets[u], NULL);
+        if (covered > best) {
+            best = covered;
+            pivot = u;
+        }
+    }
+    int *cand = (int *) malloc(sizeof(int) * np);
+    if (cand == NULL) {
+        free(p);
+        free(x);
+        return 0;
+    }
+    int ncand = difference(p, np, g->adj + g->offsets[pivot], g->offsets[pivot + 1] - g->offsets[pivot], cand);
+
+    // every candidate is moved to x, room is reserved up front
+    if (x_capacity < nx + ncand) {
+        int *grown = (int *) realloc(x, sizeof(int) * (nx + ncand));
+        if (grown == NULL) {
+            free(p);
+            free(x);
+            free(cand);
+            return 0;
+        }
+        x = grown;
+    }
+    bk_frame_t *f = st->stack + rsize - 1;
+    f->p = p;
+    f->np = np;
+    f->x = x;
+    f->nx = nx;
+    f->cand = cand;
+    f->ncand = ncand;
+    f->next = 0;
+    st->depth = rsize;
+    return 1;
+}
+
+static int bk_start(bk_state_t *st, enum_batch_t *out, const int *vertices, const int *rank, int v) {
+    const enum_graph_t *g = st->graph;
+    int degree = g->offsets[v + 1] - g->offsets[v];
+    int *p = (int *) malloc(sizeof(int) * (degree + 1));
+    int *x = (int *) malloc(sizeof(int) * (degree + 1));
+    if (p == NULL || x == NULL) {
+        free(p);
+        free(x);
+        return 0;
+    }
+    int np = 0, nx = 0;
+    for (int k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+        int w = g->adj[k];
+        if (rank[w] > rank[v]) {
+            p[np++] = w;
+        } else {
+            x[nx++] = w;
+        }
+    }
+    st->r[0] = v;
+    st->depth = 0;
+    return bk_enter(st, out, vertices, p, np, x, nx, degree + 1, 1);
+}
+
+// continue until the current root is exhausted, the batch has limit results
+// or steps expansions have been made, a negative steps means no bound
+static int bk_step(bk_state_t *st, enum_batch_t *out, const int *vertices, int limit, int steps) {
+    const enum_graph_t *g = st->graph;
+    while (st->depth > 0 && out->count < limit && steps != 0) {
+        if (steps > 0) {
+            steps--;
+        }
+        bk_frame_t *f = st->stack + st->depth - 1;
+        if (f->next == f->ncand) {
+            bk_free_frame(f);
+            st->depth--;
+            continue;
+        }
+        int w = f->cand[f->next++];
+        const int *nw = g->adj + g->offsets[w];
+        int dw = g->offsets[w + 1] - g->offsets[w];
+
+        int x_capacity = f->nx + 1;
+        int *p = (int *) malloc(sizeof(int) * (f->np + 1));
+        int *x = (int *) malloc(sizeof(int) * x_capacity);
+        if (p == NULL || x == NULL) {
+            free(p);
+            free(x);
+            return 0;
+        }
+        int np = intersect(f->p, f->np, nw, dw, p);
+        int nx = intersect(f->x, f->nx, nw, dw, x);
+
+        // move w from p to x, keeping both sorted
+        int *at = (int *) bsearch(&w, f->p, f->np, sizeof(int), compare_int);
+        memmove(at, at + 1, sizeof(int) * (f->np - (at - f->p) - 1));
+        f->np--;
+        int k = f->nx;
+        while (k > 0 && f->x[k - 1] > w) {
+            f->x[k] = f->x[k - 1];
+            k--;
+        }
+        f->x[k] = w;
+        f->nx++;
+
+        int rsize = st->depth + 1;
+        st->r[rsize - 1] = w;
+        if (!bk_enter(st, out, vertices, p, np, x, nx, x_capacity, rsize)) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void bk_clear(bk_state_t *st) {
+    while (st->depth > 0) {
+        bk_free_frame(st->stack + --st->depth);
+    }
+}
+
+static int bk_init(bk_state_t *st, const enum_graph_t *g, int min_size) {
+    st->graph = g;
+    st->min_size = min_size;
+    st->depth = 0;
+    st->stack = (bk_frame_t *) malloc(sizeof(bk_frame_t) * (g->n + 1));
+    st->r = (int *) malloc(sizeof(int) * (g->n + 1));
+    return st->stack != NULL && st->r != NULL;
+}
+
+static void bk_destroy(bk_state_t *st) {
+    if (st->stack != NULL) {
+        bk_clear(st);
+    }
+    free(st->stack);
+    free(st->r);
+}
+
+// degeneracy ordering by repeatedly removing a vertex of minimum degree
+static int degeneracy_order(const enum_graph_t *g, int *order, int *rank) {
+    int n = g->n, max_degree = 0;
+    int *degree = (int *) malloc(sizeof(int) * (n + 1));
+    int *bin = NULL, *pos = NULL, *vert = NULL;
+    for (int v = 0; v < n && degree != NULL; v++) {
+        degree[v] = g->offsets[v + 1] - g->offsets[v];
+        if (degree[v] > max_degree) {
+            max_degree = degree[v];
+        }
+    }
+    bin = (int *) calloc(max_degree + 2, sizeof(int));
+    pos = (int *) malloc(sizeof(int) * (n + 1));
+    vert = (int *) malloc(sizeof(int) * (n + 1));
+    if (degree == NULL || bin == NULL || pos == NULL || vert == NULL) {
+        free(degree);
+        free(bin);
+        free(pos);
+        free(vert);
+        return 0;
+    }
+    for (int v = 0; v < n; v++) {
+        bin[degree[v]]++;
+    }
+    for (int d = 0, start = 0; d <= max_degree; d++) {
+        int count = bin[d];
+        bin[d] = start;
+        start += count;
+    }
+    for (int v = 0; v < n; v++) {
+        pos[v] = bin[degree[v]]++;
+        vert[pos[v]] = v;
+    }
+    for (int d = max_degree; d > 0; d--) {
+        bin[d] = bin[d - 1];
+    }
+    bin[0] = 0;
+    for (int i = 0; i < n; i++) {
+        int v = vert[i];
+        order[i] = v;
+        rank[v] = i;
+        for (int k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+            int u = g->adj[k];
+            if (degree[u] > degree[v]) {
+                // swap u with the first vertex of its bin and shrink the bin
+                int du = degree[u], pu = pos[u], pw = bin[du], w = vert[pw];
+                if (u != w) {
+                    pos[u] = pw;
+                    vert[pu] = w;
+                    pos[w] = pu;
+                    vert[pw] = u;
+                }
+                bin[du]++;
+                degree[u]--;
+            }
+        }
+    }
+    free(degree);
+    free(bin);
+    free(pos);
+    free(vert);
+    return 1;
+}
+
+// Johnson's simple cycle enumeration, restricted to the strongly connected
+// component of the start vertex
+
+static int strongly_connected_components(const enum_graph_t *g, int *component) {
+    int n = g->n;
+    int *index = (int *) malloc(sizeof(int) * (n + 1));
+    int *low = (int *) malloc(sizeof(int) * (n + 1));
+    int *stack = (int *) malloc(sizeof(int) * (n + 1));
+    int *calls = (int *) malloc(sizeof(int) * (n + 1));
+    int *next = (int *) malloc(sizeof(int) * (n + 1));
+    unsigned char *on_stack = (unsigned char *) calloc(n + 1, 1);
+    if (index == NULL || low == NULL || stack == NULL || calls == NULL || next == NULL || on_stack == NULL) {
+        free(index);
+        free(low);
+        free(stack);
+        free(calls);
+        free(next);
+        free(on_stack);
+        return 0;
+    }
+    for (int v = 0; v < n; v++) {
+        index[v] = -1;
+    }
+    int counter = 0, top = 0, components = 0;
+    for (int root = 0; root < n; root++) {
+        if (index[root] != -1) {
+            continue;
+        }
+        int depth = 0;
+        calls[depth++] = root;
+        index[root] = low[root] = counter++;
+        next[root] = g->offsets[root];
+        stack[top++] = root;
+        on_stack[root] = 1;
+        while (depth > 0) {
+            int v = calls[depth - 1];
+            if (next[v] < g->offsets[v + 1]) {
+                int w = g->adj[next[v]++];
+                if (index[w] == -1) {
+                    index[w] = low[w] = counter++;
+                    next[w] = g->offsets[w];
+                    stack[top++] = w;
+                    on_stack[w] = 1;
+                    calls[depth++] = w;
+                } else if (on_stack[w] && index[w] < low[v]) {
+                    low[v] = index[w];
+                }
+                continue;
+            }
+            if (low[v] == index[v]) {
+                int w;
+                do {
+                    w = stack[--top];
+                    on_stack[w] = 0;
+                    component[w] = components;
+                } while (w != v);
+                components++;
+            }
+            depth--;
+            if (depth > 0 && low[v] < low[calls[depth - 1]]) {
+                low[calls[depth - 1]] = low[v];
+            }
+        }
+    }
+    free(index);
+    free(low);
+    free(stack);
+    free(calls);
+    free(next);
+    free(on_stack);
+    return 1;
+}
+
+static int js_follows(const johnson_state_t *js, int w) {
+    return w >= js->s && js->component[w] == js->component[js->s];
+}
+
+static void js_touch(johnson_state_t *js, int v) {
+    if (!js->is_touched[v]) {
+        js->is_touched[v] = 1;
+        js->touched[js->touched_count++] = v;
+    }
+}
+
+static void js_reset(johnson_state_t *js) {
+    for (int i = 0; i < js->touched_count; i++) {
+        int v = js->touched[i];
+        js->blocked[v] = 0;
+        js->b_size[v] = 0;
+        js->is_touched[v] = 0;
+    }
+    js->touched_count = 0;
+}
+
+static void js_unblock(johnson_state_t *js, int u) {
+    int top = 0;
+    js->unblock_stack[top++] = u;
+    js->blocked[u] = 0;
+    while (top > 0) {
+        int v = js->unblock_stack[--top];
+        while (js->b_size[v] > 0) {
+            int w = js->b[v][--js->b_size[v]];
+            if (js->blocked[w]) {
+                js->blocked[w] = 0;
+                js->unblock_stack[top++] = w;
+            }
+        }
+    }
+}
+
+static int js_add_b(johnson_state_t *js, int w, int v) {
+    for (int i = 0; i < js->b_size[w]; i++) {
+        if (js->b[w][i] == v) {
+            return 1;
+        }
+    }
+    if (js->b_size[w] == js->b_capacity[w]) {
+        int capacity = js->b_capacity[w] > 0 ? 2 * js->b_capacity[w] : 4;
+        int *grown = (int *) realloc(js->b[w], sizeof(int) * capacity);
+        if (grown == NULL) {
+            return 0;
+        }
+        js->b[w] = grown;
+        js->b_capacity[w] = capacity;
+    }
+    js->b[w][js->b_size[w]++] = v;
+    js_touch(js, w);
+    return 1;
+}
+
+static void js_push(johnson_state_t *js, int v) {
+    johnson_frame_t *f = js->stack + js->depth;
+    f->v = v;
+    f->next = js->graph->offsets[v];
+    f->found = 0;
+    js->path[js->depth++] = v;
+    js->blocked[v] = 1;
+    js_touch(js, v);
+}
+
+static int js_step(johnson_state_t *js, enum_batch_t *out, const int *vertices, int limit) {
+    const enum_graph_t *g = js->graph;
+    while (js->depth > 0 && out->count < limit) {
+        johnson_frame_t *f = js->stack + js->depth - 1;
+        int v = f->v;
+        if (f->next < g->offsets[v + 1]) {
+            int w = g->adj[f->next++];
+            if (!js_follows(js, w)) {
+                continue;
+            }
+            if (w == js->s) {
+                f->found = 1;
+                if (js->depth >= js->min_size && !batch_add(out, vertices, js->path, js->depth)) {
+                    return 0;
+                }
+            } else if (!js->blocked[w]) {
+                js_push(js, w);
+            }
+            continue;
+        }
+
+        int found = f->found;
+        if (found) {
+            js_unblock(js, v);
+        } else {
+            for (int k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+                int w = g->adj[k];
+                if (js_follows(js, w) && !js_add_b(js, w, v)) {
+                    return 0;
+                }
+            }
+        }
+        js->depth--;
+        if (js->depth > 0 && found) {
+            js->stack[js->depth - 1].found = 1;
+        }
+    }
+    return 1;
+}
+
+// parallel cliques, each round runs the workers until the round has produced
+// enough results for the batch, the roots are exhausted or the time is up
+
+static long long monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static void bk_worker_run(void *ctx, int worker, int item) {
+    enumeration_t *e = (enumeration_t *) ctx;
+    bk_worker_t *w = e->workers + item;
+    const int *vertices = e->csr->vertices;
+    (void) worker;
+    while (!__atomic_load_n(&e->stop, __ATOMIC_RELAXED) && __atomic_load_n(&e->produced, __ATOMIC_RELAXED) < e->limit) {
+        int before = w->out.count;
+        if (w->bk.depth == 0) {
+            int root = __atomic_fetch_add(&e->next_root, 1, __ATOMIC_RELAXED);
+            if (root >= e->graph.n) {
+                break;
+            }
+            w->failed = !bk_start(&w->bk, &w->out, vertices, e->rank, e->order[root]);
+        }
+        w->failed = w->failed || !bk_step(&w->bk, &w->out, vertices, before + 1, ENUM_WORKER_STEPS);
+        if (w->failed) {
+            __atomic_store_n(&e->stop, 1, __ATOMIC_RELAXED);
+            break;
+        }
+        if (w->out.count > before) {
+            __atomic_fetch_add(&e->produced, w->out.count - before, __ATOMIC_RELAXED);
+        }
+        if (e->deadline_ns > 0 && monotonic_ns() >= e->deadline_ns) {
+            __atomic_store_n(&e->stop, 1, __ATOMIC_RELAXED);
+            break;
+        }
+    }
+}
+
+static int bk_workers_next_batch(enumeration_t *e, int limit) {
+    int buffered = 0;
+    for (int i = 0; i < e->threads; i++) {
+        buffered += e->workers[i].out.count;
+    }
+    if (!e->finished && buffered < limit) {
+        e->limit = limit;
+        e->produced = buffered;
+        e->stop = 0;
+        long long start = monotonic_ns();
+        e->deadline_ns = e->timeout_ns > 0 ? start + e->timeout_ns - e->elapsed_ns : 0;
+        jgrapht_parallel_for(e->threads, e->threads, 1, bk_worker_run, e);
+        e->elapsed_ns += monotonic_ns() - start;
+
+        int finished = e->next_root >= e->graph.n;
+        for (int i = 0; i < e->threads; i++) {
+            if (e->workers[i].failed) {
+                return 0;
+            }
+            finished = finished && e->workers[i].bk.depth == 0;
+        }
+        // after a timeout only the results already found are returned
+        e->finished = finished || (e->timeout_ns > 0 && e->elapsed_ns >= e->timeout_ns);
+    }
+
+    // merge the private batches, starting from a different worker every time
+    enum_batch_t *b = &e->batch;
+    for (int k = 0; k < e->threads && b->count < limit; k++) {
+        enum_batch_t *out = &e->workers[(e->next_worker + k) % e->threads].out;
+        int taken = 0;
+        while (taken < out->count && b->count < limit) {
+            int begin = out->offsets[taken];
+            if (!batch_add(b, NULL, out->members + begin, out->offsets[taken + 1] - begin)) {
+                return 0;
+            }
+            taken++;
+        }
+        batch_drop_front(out, taken);
+    }
+    e->next_worker = (e->next_worker + 1) % e->threads;
+    return 1;
+}
+
+// public api
+
+static void enumeration_free(enumeration_t *e) {
+    if (e->kind == ENUM_CLIQUES) {
+        bk_destroy(&e->bk);
+        if (e->workers != NULL) {
+            for (int i = 0; i < e->threads; i++) {
+                bk_destroy(&e->workers[i].bk);
+                free(e->workers[i].out.offsets);
+                free(e->workers[i].out.members);
+            }
+            free(e->workers);
+        }
+        free(e->order);
+        free(e->rank);
+    } else {
+        johnson_state_t *js = &e->js;
+        if (js->b != NULL) {
+            for (int v = 0; v < e->graph.n; v++) {
+                free(js->b[v]);
+            }
+        }
+        free(js->b);
+        free(js->b_size);
+        free(js->b_capacity);
+        free(js->stack);
+        free(js->path);
+        free(js->blocked);
+        free(js->touched);
+        free(js->is_touched);
+        free(js->unblock_stack);
+        free(e->component);
+    }
+    free(e->batch.offsets);
+    free(e->batch.members);
+    enum_graph_destroy(&e->graph);
+    if (e->csr != NULL) {
+        jgrapht_csr_destroy(e->csr);
+    }
+    free(e);
+}
+
+static int enumeration_create(void *g, int kind, int min_size, long long max_results, enumeration_t **res) {
+    enumeration_t *e = (enumeration_t *) calloc(1, sizeof(enumeration_t));
+    if (e == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    e->kind = kind;
+    e->min_size = min_size;
+    e->max_results = max_results;
+    int status = jgrapht_csr_create(g, &e->csr);
+    if (status != STATUS_SUCCESS) {
+        e->csr = NULL;
+        enumeration_free(e);
+        return status;
+    }
+    if (kind == ENUM_CYCLES && !e->csr->directed) {
+        enumeration_free(e);
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Graph must be directed");
+    }
+    if (!enum_graph_create(e->csr, kind == ENUM_CLIQUES, &e->graph)) {
+        enumeration_free(e);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    *res = e;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_clique_enumeration_create(void *g, int min_size, long long max_results, void** res) {
+    enumeration_t *e;
+    int status = enumeration_create(g, ENUM_CLIQUES, min_size, max_results, &e);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = e->graph.n;
+    e->order = (int *) malloc(sizeof(int) * (n + 1));
+    e->rank = (int *) malloc(sizeof(int) * (n + 1));
+    if (e->order == NULL || e->rank == NULL || !bk_init(&e->bk, &e->graph, min_size)
+            || !degeneracy_order(&e->graph, e->order, e->rank)) {
+        enumeration_free(e);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    *res = e;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_clique_enumeration_create_parallel(void *g, int min_size, long long max_results, long long timeout, int threads, void** res) {
+    enumeration_t *e;
+    int status = enumeration_create(g, ENUM_CLIQUES, min_size, max_results, &e);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = e->graph.n;
+    e->threads = jgrapht_parallel_threads(threads);
+    e->timeout_ns = timeout > 0 ? timeout * 1000000000LL : 0;
+    e->order = (int *) malloc(sizeof(int) * (n + 1));
+    e->rank = (int *) malloc(sizeof(int) * (n + 1));
+    e->workers = (bk_worker_t *) calloc(e->threads, sizeof(bk_worker_t));
+    int ok = e->order != NULL && e->rank != NULL && e->workers != NULL
+        && degeneracy_order(&e->graph, e->order, e->rank);
+    for (int i = 0; ok && i < e->threads; i++) {
+        ok = bk_init(&e->workers[i].bk, &e->graph, min_size);
+    }
+    if (!ok) {
+        enumeration_free(e);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    *res = e;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_cycles_simple_enumeration_create(void *g, int min_size, long long max_results, void** res) {
+    enumeration_t *e;
+    int status = enumeration_create(g, ENUM_CYCLES, min_size, max_results, &e);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = e->graph.n;
+    johnson_state_t *js = &e->js;
+    e->component = (int *) malloc(sizeof(int) * (n + 1));
+    js->graph = &e->graph;
+    js->component = e->component;
+    js->min_size = min_size;
+    js->s = -1;
+    js->stack = (johnson_frame_t *) malloc(sizeof(johnson_frame_t) * (n + 1));
+    js->path = (int *) malloc(sizeof(int) * (n + 1));
+    js->blocked = (unsigned char *) calloc(n + 1, 1);
+    js->b = (int **) calloc(n + 1, sizeof(int *));
+    js->b_size = (int *) calloc(n + 1, sizeof(int));
+    js->b_capacity = (int *) calloc(n + 1, sizeof(int));
+    js->touched = (int *) malloc(sizeof(int) * (n + 1));
+    js->is_touched = (unsigned char *) calloc(n + 1, 1);
+    js->unblock_stack = (int *) malloc(sizeof(int) * (n + 1));
+    if (e->component == NULL || js->stack == NULL || js->path == NULL || js->blocked == NULL || js->b == NULL
+            || js->b_size == NULL || js->b_capacity == NULL || js->touched == NULL || js->is_touched == NULL
+            || js->unblock_stack == NULL || !strongly_connected_components(&e->graph, e->component)) {
+        enumeration_free(e);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    *res = e;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_enumeration_destroy(void *h) {
+    if (h != NULL) {
+        enumeration_free((enumeration_t *) h);
+    }
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_enumeration_next_batch(void *h, int batch_size, int *results, int *members) {
+    enumeration_t *e = (enumeration_t *) h;
+    if (batch_size < 1) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Batch size must be positive");
+    }
+    if (e->failed) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    enum_batch_t *b = &e->batch;
+    b->count = 0;
+    b->members_size = 0;
+
+    int limit = batch_size;
+    if (e->max_results > 0 && e->max_results - e->emitted < limit) {
+        limit = (int) (e->max_results - e->emitted);
+    }
+    const int *vertices = e->csr->vertices;
+    int ok = 1;
+    if (e->workers != NULL) {
+        ok = bk_workers_next_batch(e, limit);
+    }
+    while (ok && e->workers == NULL && b->count < limit) {
+        if (e->kind == ENUM_CLIQUES) {
+            if (e->bk.depth == 0) {
+                if (e->next_root == e->graph.n) {
+                    break;
+                }
+                ok = bk_start(&e->bk, b, vertices, e->rank, e->order[e->next_root++]);
+            }
+            ok = ok && bk_step(&e->bk, b, vertices, limit, -1);
+        } else {
+            johnson_state_t *js = &e->js;
+            if (js->depth == 0) {
+                if (js->s + 1 == e->graph.n) {
+                    break;
+                }
+                js_reset(js);
+                js->s++;
+                js_push(js, js->s);
+            }
+            ok = js_step(js, b, vertices, limit);
+        }
+    }
+    if (!ok) {
+        e->failed = 1;
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    e->emitted += b->count;
+    *results = b->count;
+    *members = b->members_size;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_enumeration_batch_copy(void *h, int *members, int members_size, int *offsets, int offsets_size) {
+    enumeration_t *e = (enumeration_t *) h;
+    enum_batch_t *b = &e->batch;
+    if (members_size < b->members_size || offsets_size < b->count + 1) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result arrays smaller than the batch");
+    }
+    memcpy(members, b->members, sizeof(int) * b->members_size);
+    if (b->count > 0) {
+        memcpy(offsets, b->offsets, sizeof(int) * (b->count + 1));
+    } else {
+        offsets[0] = 0;
+    }
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,446 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Maximum s-t flows on a residual network which is built once and then reused
+// for many queries and capacity updates. Queries run Dinic's algorithm, each
+// on a private copy of the residual capacities, and are executed in parallel.
+// Capacities are the edge weights when the solver is created. Undirected edges
+// become two arcs with the full capacity which are the reverse of each other,
+// directed edges get a reverse arc with zero capacity. Self-loops carry no flow
+// and are left out.
+//
+// Batches release the GIL, thus they may run concurrently on the same solver.
+// The buffers kept by the solver are used by one batch at a time, the others
+// allocate their own. Capacity updates wait until running batches are done.
+
+#define FLOW_EPSILON 1e-9
+
+typedef struct {
+    double *residual;
+    int *level;
+    int *current;
+    int *queue;
+    int *path;
+} flow_worker_t;
+
+typedef struct {
+    jgrapht_csr_t *csr;
+    int n;
+    int m;
+    int *offsets;
+    int *heads;
+    int *reverse;
+    double *capacity;
+    // arc of each edge position in the direction of the edge, -1 for self-loops
+    int *edge_arcs;
+    // edge ids sorted, with their positions
+    int *sorted_edges;
+    int *sorted_positions;
+    flow_worker_t *workers;
+    int workers_count;
+    // guards the workers
+    pthread_mutex_t lock;
+    // read by batches, written by capacity updates
+    pthread_rwlock_t capacity_lock;
+} flow_solver_t;
+
+typedef struct {
+    flow_solver_t *solver;
+    flow_worker_t *workers;
+    const int *sources;
+    const int *sinks;
+    double *values;
+    int *cuts;
+    int words;
+} flow_ctx_t;
+
+static void flow_worker_destroy(flow_worker_t *w) {
+    free(w->residual);
+    free(w->level);
+    free(w->current);
+    free(w->queue);
+    free(w->path);
+}
+
+static void flow_workers_destroy(flow_worker_t *workers, int count) {
+    for (int i = 0; i < count; i++) {
+        flow_worker_destroy(&workers[i]);
+    }
+    free(workers);
+}
+
+int jgrapht_maxflow_solver_destroy(void *handle) {
+    flow_solver_t *fs = (flow_solver_t *) handle;
+    if (fs != NULL) {
+        flow_workers_destroy(fs->workers, fs->workers_count);
+        pthread_mutex_destroy(&fs->lock);
+        pthread_rwlock_destroy(&fs->capacity_lock);
+        free(fs->offsets);
+        free(fs->heads);
+        free(fs->reverse);
+        free(fs->capacity);
+        free(fs->edge_arcs);
+        free(fs->sorted_edges);
+        free(fs->sorted_positions);
+        if (fs->csr != NULL) {
+            jgrapht_csr_destroy(fs->csr);
+        }
+        free(fs);
+    }
+    return STATUS_SUCCESS;
+}
+
+static __thread const int *sort_keys;
+
+static int compare_positions(const void *a, const void *b) {
+    int x = sort_keys[*(const int *) a], y = sort_keys[*(const int *) b];
+    return (x > y) - (x < y);
+}
+
+static int compare_int_keys(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+int jgrapht_maxflow_solver_create(void *g, void** res) {
+    flow_solver_t *fs = calloc(1, sizeof(flow_solver_t));
+    if (fs == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    pthread_mutex_init(&fs->lock, NULL);
+    pthread_rwlock_init(&fs->capacity_lock, NULL);
+    int status;
+    if ((status = jgrapht_csr_create(g, &fs->csr)) != STATUS_SUCCESS) {
+        fs->csr = NULL;
+        jgrapht_maxflow_solver_destroy(fs);
+        return status;
+    }
+    jgrapht_csr_t *csr = fs->csr;
+    int n = fs->n = csr->n;
+    int m = fs->m = csr->m;
+    if (csr->negative_weights) {
+        jgrapht_maxflow_solver_destroy(fs);
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative capacities not allowed");
+    }
+
+    // the arcs of an edge are reached from the outgoing adjacency of its
+    // tail, for undirected graphs only from the endpoint with the smaller
+    // position
+    int *tails = malloc(sizeof(int) * (m > 0 ? m : 1));
+    int *edge_heads = malloc(sizeof(int) * (m > 0 ? m : 1));
+    double *weights = malloc(sizeof(double) * (m > 0 ? m : 1));
+    int *edge_ids = malloc(sizeof(int) * (m > 0 ? m : 1));
+    fs->offsets = calloc(n + 1, sizeof(int));
+    fs->edge_arcs = malloc(sizeof(int) * (m > 0 ? m : 1));
+    fs->sorted_edges = malloc(sizeof(int) * (m > 0 ? m : 1));
+    fs->sorted_positions = malloc(sizeof(int) * (m > 0 ? m : 1));
+    if (tails == NULL || edge_heads == NULL || weights == NULL || edge_ids == NULL || fs->offsets == NULL
+            || fs->edge_arcs == NULL || fs->sorted_edges == NULL || fs->sorted_positions == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        goto cleanup;
+    }
+    int count = 0;
+    for (int u = 0; u < n; u++) {
+        for (int k = csr->out_offsets[u]; k < csr->out_offsets[u + 1]; k++) {
+            int v = csr->out_targets[k];
+            if (!csr->directed && v < u) {
+                continue;
+            }
+            tails[count] = u;
+            edge_heads[count] = v;
+            weights[count] = csr->out_weights[k];
+            edge_ids[count] = csr->out_edges[k];
+            count++;
+        }
+    }
+    int arcs = 0;
+    for (int i = 0; i < m; i++) {
+        if (tails[i] != edge_heads[i]) {
+            fs->offsets[tails[i] + 1]++;
+            fs->offsets[edge_heads[i] + 1]++;
+            arcs += 2;
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        fs->offsets[v + 1] += fs->offsets[v];
+    }
+    fs->heads = malloc(sizeof(int) * (arcs > 0 ? arcs : 1));
+    fs->reverse = malloc(sizeof(int) * (arcs > 0 ? arcs : 1));
+    fs->capacity = malloc(sizeof(double) * (arcs > 0 ? arcs : 1));
+    int *next = malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (fs->heads == NULL || fs->reverse == NULL || fs->capacity == NULL || next == NULL) {
+        free(next);
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        goto cleanup;
+    }
+    memcpy(next, fs->offsets, sizeof(int) * n);
+    for (int i = 0; i < m; i++) {
+        int u = tails[i], v = edge_heads[i];
+        fs->sorted_positions[i] = i;
+        if (u == v) {
+            fs->edge_arcs[i] = -1;
+            continue;
+        }
+        int a = next[u]++, b = next[v]++;
+        fs->heads[a] = v;
+        fs->heads[b] = u;
+        fs->reverse[a] = b;
+        fs->reverse[b] = a;
+        fs->capacity[a] = weights[i];
+        fs->capacity[b] = csr->directed ? 0.0 : weights[i];
+        fs->edge_arcs[i] = a;
+    }
+    free(next);
+    sort_keys = edge_ids;
+    qsort(fs->sorted_positions, m, sizeof(int), compare_positions);
+    for (int i = 0; i < m; i++) {
+        fs->sorted_edges[i] = edge_ids[fs->sorted_positions[i]];
+    }
+
+cleanup:
+    free(tails);
+    free(edge_heads);
+    free(weights);
+    free(edge_ids);
+    if (status != STATUS_SUCCESS) {
+        jgrapht_maxflow_solver_destroy(fs);
+        return status;
+    }
+    *res = fs;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_maxflow_solver_vertices(void *handle, int *vertices, int vertices_size, int* res) {
+    flow_solver_t *fs = (flow_solver_t *) handle;
+    if (vertices_size < fs->n) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Array smaller than the number of vertices");
+    }
+    memcpy(vertices, fs->csr->vertices, sizeof(int) * fs->n);
+    *res = fs->n;
+    return STATUS_SUCCESS;
+}
+
+// Changes the capacities of the given edges, which apply to the following
+// queries. The reverse arc of an undirected edge changes as well.
+int jgrapht_maxflow_solver_set_capacities(void *handle, int *edges, int edges_size, double *capacities, int capacities_size) {
+    flow_solver_t *fs = (flow_solver_t *) handle;
+    if (edges_size != capacities_size) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Edges and capacities arrays must have the same length");
+    }
+    // validate everything first, thus a failure changes nothing
+    for (int i = 0; i < edges_size; i++) {
+        if (!(capacities[i] >= 0.0)) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative capacities not allowed");
+        }
+        if (bsearch(&edges[i], fs->sorted_edges, fs->m, sizeof(int), compare_int_keys) == NULL) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Edge not contained in the graph");
+        }
+    }
+    pthread_rwlock_wrlock(&fs->capacity_lock);
+    for (int i = 0; i < edges_size; i++) {
+        int *found = bsearch(&edges[i], fs->sorted_edges, fs->m, sizeof(int), compare_int_keys);
+        int a = fs->edge_arcs[fs->sorted_positions[found - fs->sorted_edges]];
+        if (a == -1) {
+            continue;
+        }
+        fs->capacity[a] = capacities[i];
+        if (!fs->csr->directed) {
+            fs->capacity[fs->reverse[a]] = capacities[i];
+        }
+    }
+    pthread_rwlock_unlock(&fs->capacity_lock);
+    return STATUS_SUCCESS;
+}
+
+// levels of the residual network from the source, returns whether the sink
+// is reachable
+static int dinic_levels(const flow_solver_t *fs, flow_worker_t *w, int s, int t) {
+    memset(w->level, -1, sizeof(int) * fs->n);
+    int head = 0, tail = 0;
+    w->level[s] = 0;
+    w->queue[tail++] = s;
+    while (head < tail) {
+        int u = w->queue[head++];
+        for (int a = fs->offsets[u]; a < fs->offsets[u + 1]; a++) {
+            int v = fs->heads[a];
+            if (w->level[v] == -1 && w->residual[a] > FLOW_EPSILON) {
+                w->level[v] = w->level[u] + 1;
+                w->queue[tail++] = v;
+            }
+        }
+    }
+    return w->level[t] != -1;
+}
+
+// blocking flow along the level graph, with an explicit path instead of
+// recursion
+static double dinic_blocking_flow(const flow_solver_t *fs, flow_worker_t *w, int s, int t) {
+    memcpy(w->current, fs->offsets, sizeof(int) * fs->n);
+    double total = 0.0;
+    int length = 0;
+    int v = s;
+    for (;;) {
+        if (v == t) {
+            double bottleneck = w->residual[w->path[0]];
+            for (int i = 1; i < length; i++) {
+                if (w->residual[w->path[i]] < bottleneck) {
+                    bottleneck = w->residual[w->path[i]];
+                }
+            }
+            int saturated = -1;
+            for (int i = 0; i < length; i++) {
+                int a = w->path[i];
+                w->residual[a] -= bottleneck;
+                w->residual[fs->reverse[a]] += bottleneck;
+                if (saturated == -1 && w->residual[a] <= FLOW_EPSILON) {
+                    saturated = i;
+                }
+            }
+            total += bottleneck;
+            // continue from the tail of the first saturated arc
+            length = saturated;
+            v = length == 0 ? s : fs->heads[w->path[length - 1]];
+            continue;
+        }
+        int end = fs->offsets[v + 1];
+        while (w->current[v] < end) {
+            int a = w->current[v];
+            if (w->residual[a] > FLOW_EPSILON && w->level[fs->heads[a]] == w->level[v] + 1) {
+                break;
+            }
+            w->current[v]++;
+        }
+        if (w->current[v] == end) {
+            // dead end, never visit again in this phase
+            w->level[v] = -1;
+            if (length == 0) {
+                break;
+            }
+            length--;
+            v = length == 0 ? s : fs->heads[w->path[length - 1]];
+            w->current[v]++;
+            continue;
+        }
+        w->path[length++] = w->current[v];
+        v = fs->heads[w->current[v]];
+    }
+    return total;
+}
+
+static void flow_body(void *arg, int worker, int item) {
+    flow_ctx_t *ctx = (flow_ctx_t *) arg;
+    flow_solver_t *fs = ctx->solver;
+    flow_worker_t *w = ctx->workers + worker;
+    int s = ctx->sources[item], t = ctx->sinks[item];
+    memcpy(w->residual, fs->capacity, sizeof(double) * fs->offsets[fs->n]);
+    double value = 0.0;
+    while (dinic_levels(fs, w, s, t)) {
+        value += dinic_blocking_flow(fs, w, s, t);
+    }
+    ctx->values[item] = value;
+    if (ctx->cuts != NULL) {
+        // the last search reached exactly the source side of a minimum cut
+        int *row = ctx->cuts + (size_t) item * ctx->words;
+        memset(row, 0, sizeof(int) * ctx->words);
+        for (int v = 0; v < fs->n; v++) {
+            if (w->level[v] != -1) {
+                row[v / 32] |= (int) (1u << (v % 32));
+            }
+        }
+    }
+}
+
+// grows the buffers in workers to at least threads of them
+static int flow_workers_reserve(const flow_solver_t *fs, flow_worker_t **workers, int *count, int threads) {
+    if (threads <= *count) {
+        return STATUS_SUCCESS;
+    }
+    flow_worker_t *grown = realloc(*workers, sizeof(flow_worker_t) * threads);
+    if (grown == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    *workers = grown;
+    int n = fs->n > 0 ? fs->n : 1;
+    int arcs = fs->offsets[fs->n] > 0 ? fs->offsets[fs->n] : 1;
+    while (*count < threads) {
+        flow_worker_t *w = &grown[*count];
+        w->residual = malloc(sizeof(double) * arcs);
+        w->level = malloc(sizeof(int) * n);
+        w->current = malloc(sizeof(int) * n);
+        w->queue = malloc(sizeof(int) * n);
+        w->path = malloc(sizeof(int) * n);
+        if (w->residual == NULL || w->level == NULL || w->current == NULL || w->queue == NULL || w->path == NULL) {
+            flow_worker_destroy(w);
+            return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        }
+        (*count)++;
+    }
+    return STATUS_SUCCESS;
+}
+
+// Computes the maximum flow value from sources[i] to sinks[i] for every i. If
+// cuts is not NULL, row i of (n + 31) / 32 words holds the source side of a
+// minimum cut, bit v % 32 of word v / 32 is set for the vertex at position v.
+// Buffers for the threads are kept by the solver for later queries, unless
+// another batch is using them.
+int jgrapht_maxflow_solver_exec_batch(void *handle, int *sources, int sources_size, int *sinks, int sinks_size,
+        int threads, double *values, int values_size, int *cuts, int cuts_size) {
+    flow_solver_t *fs = (flow_solver_t *) handle;
+    int queries = sources_size;
+    int words = (fs->n + 31) / 32;
+    if (sinks_size != queries) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Sources and sinks arrays must have the same length");
+    }
+    if (values_size < queries || (cuts != NULL && (long long) cuts_size < (long long) queries * words)) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result arrays smaller than the queries");
+    }
+    int *s = malloc(sizeof(int) * (queries > 0 ? queries : 1));
+    int *t = malloc(sizeof(int) * (queries > 0 ? queries : 1));
+    int status = STATUS_SUCCESS;
+    if (s == NULL || t == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        goto cleanup;
+    }
+    if ((status = jgrapht_csr_indices_of(fs->csr, sources, queries, s)) != STATUS_SUCCESS
+            || (status = jgrapht_csr_indices_of(fs->csr, sinks, queries, t)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+    for (int i = 0; i < queries; i++) {
+        if (s[i] == t[i]) {
+            status = jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Source equals sink");
+            goto cleanup;
+        }
+    }
+    threads = jgrapht_parallel_threads(threads);
+    if (threads > queries) {
+        threads = queries > 0 ? queries : 1;
+    }
+    int locked = pthread_mutex_trylock(&fs->lock) == 0;
+    flow_worker_t *workers = locked ? fs->workers : NULL;
+    int workers_count = locked ? fs->workers_count : 0;
+    status = flow_workers_reserve(fs, &workers, &workers_count, threads);
+    if (locked) {
+        fs->workers = workers;
+        fs->workers_count = workers_count;
+    }
+    if (status == STATUS_SUCCESS) {
+        flow_ctx_t ctx = { fs, workers, s, t, values, cuts, words };
+        pthread_rwlock_rdlock(&fs->capacity_lock);
+        jgrapht_parallel_for(queries, threads, 1, flow_body, &ctx);
+        pthread_rwlock_unlock(&fs->capacity_lock);
+    }
+    if (locked) {
+        pthread_mutex_unlock(&fs->lock);
+    } else {
+        flow_workers_destroy(workers, workers_count);
+    }
+
+cleanup:
+    free(s);
+    free(t);
+    return status;
+}
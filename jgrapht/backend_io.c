@@ -0,0 +1,1228 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Exporters write their output through a sink, a function which receives
+// consecutive chunks and returns a status code.
+typedef int (*export_sink_t)(void *, const char *, size_t);
+
+// Native binary graph snapshots.
+//
+// The file starts with a fixed size header followed by the sections below,
+// each aligned to 8 bytes. Edges are grouped by the position of their source
+// vertex, in compressed sparse row layout. Undirected edges are stored once.
+//
+//   header
+//   int32   vertices[n]          padded to a multiple of 8 bytes
+//   int64   offsets[n + 1]
+//   int32   targets[m]           vertex identifiers
+//   int32   edges[m]             edge identifiers
+//   double  weights[m]           only if the weighted flag is set
+
+#define BINARY_MAGIC "JGTCSR01"
+#define BINARY_BYTE_ORDER 0x01020304u
+#define BINARY_VERSION 1u
+#define BINARY_FLAG_DIRECTED 0x1u
+#define BINARY_FLAG_WEIGHTED 0x2u
+
+typedef struct {
+    char magic[8];
+    uint32_t byte_order;
+    uint32_t version;
+    uint32_t flags;
+    uint32_t reserved;
+    uint64_t n;
+    uint64_t m;
+} binary_header_t;
+
+static size_t align8(size_t size) {
+    return (size + 7) & ~((size_t) 7);
+}
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+static int position_of(const int *sorted, int n, int vertex) {
+    const int *p = (const int *) bsearch(&vertex, sorted, n, sizeof(int), compare_int);
+    return p != NULL ? (int) (p - sorted) : -1;
+}
+
+static int write_section(export_sink_t sink, void *sink_ctx, const void *data, size_t size) {
+    static const char padding[8] = { 0 };
+    int status = STATUS_SUCCESS;
+    if (size > 0 && (status = sink(sink_ctx, (const char *) data, size)) != STATUS_SUCCESS) {
+        return status;
+    }
+    size_t pad = align8(size) - size;
+    return pad == 0 ? STATUS_SUCCESS : sink(sink_ctx, padding, pad);
+}
+
+static int export_binary(void *g, export_sink_t sink, void *sink_ctx) {
+    int n, m, directed, weighted, status;
+    if ((status = jgrapht_graph_vertices_count(g, &n)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_edges_count(g, &m)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_is_directed(g, &directed)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_is_weighted(g, &weighted)) != STATUS_SUCCESS) {
+        return status;
+    }
+
+    int *vertices = (int *) malloc(sizeof(int) * (n + 1));
+    int *edges = (int *) malloc(sizeof(int) * (m + 1));
+    int *sources = (int *) malloc(sizeof(int) * (m + 1));
+    int *targets = (int *) malloc(sizeof(int) * (m + 1));
+    double *weights = weighted ? (double *) malloc(sizeof(double) * (m + 1)) : NULL;
+    int64_t *offsets = (int64_t *) calloc(n + 1, sizeof(int64_t));
+    int *order = (int *) malloc(sizeof(int) * (m + 1));
+    int *out_targets = (int *) malloc(sizeof(int) * (m + 1));
+    int *out_edges = (int *) malloc(sizeof(int) * (m + 1));
+    double *out_weights = weighted ? (double *) malloc(sizeof(double) * (m + 1)) : NULL;
+
+    if (vertices == NULL || edges == NULL || sources == NULL || targets == NULL || offsets == NULL
+            || order == NULL || out_targets == NULL || out_edges == NULL
+            || (weighted && (weights == NULL || out_weights == NULL))) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        goto cleanup;
+    }
+
+    int count;
+    if ((status = jgrapht_graph_vertices_array(g, vertices, n, &count)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_edges_array(g, edges, m, &count)) != STATUS_SUCCESS
+            || (status = jgrapht_graph_edges_endpoints_array(g, edges, m, sources, m, targets, m, weights, m)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+
+    // vertices are written in ascending order, which lets the source position
+    // of each edge be found by binary search
+    qsort(vertices, n, sizeof(int), compare_int);
+
+    // stable counting sort of the edges by source position
+    for (int i = 0; i < m; i++) {
+        int p = position_of(vertices, n, sources[i]);
+        order[i] = p;
+        offsets[p + 1]++;
+    }
+    for (int i = 0; i < n; i++) {
+        offsets[i + 1] += offsets[i];
+    }
+    int64_t *next = (int64_t *) malloc(sizeof(int64_t) * (n + 1));
+    if (next == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        goto cleanup;
+    }
+    memcpy(next, offsets, sizeof(int64_t) * (n + 1));
+    for (int i = 0; i < m; i++) {
+        int64_t k = next[order[i]]++;
+        out_targets[k] = targets[i];
+        out_edges[k] = edges[i];
+        if (weighted) {
+            out_weights[k] = weights[i];
+        }
+    }
+    free(next);
+
+    binary_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, BINARY_MAGIC, sizeof(header.magic));
+    header.byte_order = BINARY_BYTE_ORDER;
+    header.version = BINARY_VERSION;
+    header.flags = (directed ? BINARY_FLAG_DIRECTED : 0) | (weighted ? BINARY_FLAG_WEIGHTED : 0);
+    header.n = (uint64_t) n;
+    header.m = (uint64_t) m;
+
+    if ((status = write_section(sink, sink_ctx, &header, sizeof(header))) != STATUS_SUCCESS
+            || (status = write_section(sink, sink_ctx, vertices, sizeof(int) * (size_t) n)) != STATUS_SUCCESS
+            || (status = write_section(sink, sink_ctx, offsets, sizeof(int64_t) * ((size_t) n + 1))) != STATUS_SUCCESS
+            || (status = write_section(sink, sink_ctx, out_targets, sizeof(int) * (size_t) m)) != STATUS_SUCCESS
+            || (status = write_section(sink, sink_ctx, out_edges, sizeof(int) * (size_t) m)) != STATUS_SUCCESS
+            || (weighted && (status = write_section(sink, sink_ctx, out_weights, sizeof(double) * (size_t) m)) != STATUS_SUCCESS)) {
+        goto cleanup;
+    }
+    status = STATUS_SUCCESS;
+
+cleanup:
+    free(vertices);
+    free(edges);
+    free(sources);
+    free(targets);
+    free(weights);
+    free(offsets);
+    free(order);
+    free(out_targets);
+    free(out_edges);
+    free(out_weights);
+    return status;
+}
+
+int jgrapht_import_file_binary(char *filename, void** res) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return jgrapht_error_set_errno(STATUS_IO_ERROR, "Failed to open file for reading");
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return jgrapht_error_set_errno(STATUS_IO_ERROR, "Failed to read file");
+    }
+    size_t size = (size_t) st.st_size;
+    if (size < sizeof(binary_header_t)) {
+        close(fd);
+        return jgrapht_error_set_errno(STATUS_IMPORT_ERROR, "Invalid binary graph file");
+    }
+    char *data = (char *) mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return jgrapht_error_set_errno(STATUS_IO_ERROR, "Failed to map file");
+    }
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    int status = STATUS_SUCCESS;
+    int *sources = NULL, *targets = NULL;
+    double *weights = NULL;
+    unsigned char *seen = NULL;
+
+    const binary_header_t *header = (const binary_header_t *) data;
+    if (memcmp(header->magic, BINARY_MAGIC, sizeof(header->magic)) != 0
+            || header->byte_order != BINARY_BYTE_ORDER
+            || header->version != BINARY_VERSION
+            || header->n > INT32_MAX || header->m > INT32_MAX) {
+        status = jgrapht_error_set_errno(STATUS_IMPORT_ERROR, "Invalid binary graph file");
+        goto cleanup;
+    }
+    int n = (int) header->n, m = (int) header->m;
+    int directed = (header->flags & BINARY_FLAG_DIRECTED) != 0;
+    int weighted = (header->flags & BINARY_FLAG_WEIGHTED) != 0;
+
+    size_t vertices_at = align8(sizeof(binary_header_t));
+    size_t offsets_at = vertices_at + align8(sizeof(int32_t) * (size_t) n);
+    size_t targets_at = offsets_at + sizeof(int64_t) * ((size_t) n + 1);
+    size_t edges_at = targets_at + align8(sizeof(int32_t) * (size_t) m);
+    size_t weights_at = edges_at + align8(sizeof(int32_t) * (size_t) m);
+    size_t expected = weights_at + (weighted ? sizeof(double) * (size_t) m : 0);
+    if (size != expected) {
+        status = jgrapht_error_set_errno(STATUS_IMPORT_ERROR, "Invalid binary graph file");
+        goto cleanup;
+    }
+    const int32_t *file_vertices = (const int32_t *) (data + vertices_at);
+    const int64_t *file_offsets = (const int64_t *) (data + offsets_at);
+    const int32_t *file_targets = (const int32_t *) (data + targets_at);
+    const int32_t *file_edges = (const int32_t *) (data + edges_at);
+    const double *file_weights = weighted ? (const double *) (data + weights_at) : NULL;
+
+    if (file_offsets[0] != 0 || file_offsets[n] != m) {
+        status = jgrapht_error_set_errno(STATUS_IMPORT_ERROR, "Invalid binary graph file");
+        goto cleanup;
+    }
+
+    // sparse graphs have a continuous range of vertices starting from 0
+    int max_vertex = -1;
+    for (int i = 0; i < n; i++) {
+        if (file_vertices[i] < 0 || file_offsets[i] > file_offsets[i + 1]) {
+            status = jgrapht_error_set_errno(STATUS_IMPORT_ERROR, "Invalid binary graph file");
+            goto cleanup;
+        }
+        if (file_vertices[i] > max_vertex) {
+            max_vertex = file_vertices[i];
+        }
+    }
+    for (int k = 0; k < m; k++) {
+        if (file_targets[k] < 0 || file_targets[k] > max_vertex) {
+            status = jgrapht_error_set_errno(STATUS_IMPORT_ERROR, "Invalid binary graph file");
+            goto cleanup;
+        }
+    }
+
+    // if the edge identifiers are exactly 0 up to m-1 they are preserved,
+    // otherwise the edges are numbered in file order
+    seen = (unsigned char *) calloc(m + 1, 1);
+    sources = (int *) malloc(sizeof(int) * (m + 1));
+    targets = (int *) malloc(sizeof(int) * (m + 1));
+    if (weighted) {
+        weights = (double *) malloc(sizeof(double) * (m + 1));
+    }
+    if (seen == NULL || sources == NULL || targets == NULL || (weighted && weights == NULL)) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        goto cleanup;
+    }
+    int keep_edges = 1;
+    for (int k = 0; k < m && keep_edges; k++) {
+        int e = file_edges[k];
+        if (e < 0 || e >= m || seen[e]) {
+            keep_edges = 0;
+        } else {
+            seen[e] = 1;
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        for (int64_t k = file_offsets[i]; k < file_offsets[i + 1]; k++) {
+            int e = keep_edges ? file_edges[k] : (int) k;
+            sources[e] = file_vertices[i];
+            targets[e] = file_targets[k];
+            if (weighted) {
+                weights[e] = file_weights[k];
+            }
+        }
+    }
+
+    status = jgrapht_graph_sparse_create_from_arrays(directed, weighted, max_vertex + 1,
+            sources, m, targets, m, weights, weighted ? m : 0, res);
+
+cleanup:
+    munmap(data, size);
+    free(seen);
+    free(sources);
+    free(targets);
+    free(weights);
+    return status;
+}
+
+// Streaming edge list importer. Input is pushed in blocks of arbitrary size
+// and parsed into growing edge arrays, a partial last line is carried over to
+// the next block. Each line contains the source, the target and optionally
+// the weight of an edge as integers separated by the delimiter. Empty lines
+// and lines starting with '#' are skipped.
+
+typedef struct {
+    int directed;
+    int weighted;
+    char delimiter;
+    int finished;
+    int line;
+    int max_vertex;
+    int size;
+    int capacity;
+    int *sources;
+    int *targets;
+    double *weights;
+    char *carry;
+    int carry_size;
+    int carry_capacity;
+} edgelist_stream_t;
+
+static int is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+static int stream_error(edgelist_stream_t *s, const char *msg) {
+    char buffer[128];
+    snprintf(buffer, sizeof(buffer), "%s at line %d", msg, s->line);
+    return jgrapht_error_set_errno(STATUS_IMPORT_ERROR, buffer);
+}
+
+static int stream_grow(edgelist_stream_t *s, int extra) {
+    if ((long long) s->size + extra <= s->capacity) {
+        return STATUS_SUCCESS;
+    }
+    long long capacity = s->capacity > 0 ? s->capacity : 1024;
+    while (capacity < (long long) s->size + extra) {
+        capacity *= 2;
+    }
+    if (capacity > INT32_MAX) {
+        capacity = INT32_MAX;
+        if ((long long) s->size + extra > capacity) {
+            return jgrapht_error_set_errno(STATUS_IMPORT_ERROR, "Too many edges");
+        }
+    }
+    int *sources = (int *) realloc(s->sources, sizeof(int) * capacity);
+    if (sources != NULL) {
+        s->sources = sources;
+    }
+    int *targets = (int *) realloc(s->targets, sizeof(int) * capacity);
+    if (targets != NULL) {
+        s->targets = targets;
+    }
+    double *weights = NULL;
+    if (s->weighted) {
+        weights = (double *) realloc(s->weights, sizeof(double) * capacity);
+        if (weights != NULL) {
+            s->weights = weights;
+        }
+    }
+    if (sources == NULL || targets == NULL || (s->weighted && weights == NULL)) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    s->capacity = (int) capacity;
+    return STATUS_SUCCESS;
+}
+
+static int stream_append(edgelist_stream_t *s, int u, int v, double w) {
+    if (u < 0 || v < 0) {
+        return stream_error(s, "Negative vertex identifier");
+    }
+    int status = stream_grow(s, 1);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    s->sources[s->size] = u;
+    s->targets[s->size] = v;
+    if (s->weighted) {
+        s->weights[s->size] = w;
+    }
+    s->size++;
+    if (u > s->max_vertex) {
+        s->max_vertex = u;
+    }
+    if (v > s->max_vertex) {
+        s->max_vertex = v;
+    }
+    return STATUS_SUCCESS;
+}
+
+// find the next field, returns its end or NULL if the line has no more fields
+static const char *next_field(const edgelist_stream_t *s, const char **begin, const char *end) {
+    const char *p = *begin;
+    while (p < end && is_space(*p)) {
+        p++;
+    }
+    if (p < end && *p == s->delimiter && !is_space(s->delimiter)) {
+        p++;
+        while (p < end && is_space(*p)) {
+            p++;
+        }
+    }
+    if (p == end) {
+        return NULL;
+    }
+    *begin = p;
+    while (p < end && *p != s->delimiter && !is_space(*p)) {
+        p++;
+    }
+    return p;
+}
+
+static int parse_vertex(const char *p, const char *end, int *res) {
+    long long value = 0;
+    if (p == end) {
+        return 0;
+    }
+    for (; p < end; p++) {
+        if (*p < '0' || *p > '9') {
+            return 0;
+        }
+        value = value * 10 + (*p - '0');
+        if (value > INT32_MAX) {
+            return 0;
+        }
+    }
+    *res = (int) value;
+    return 1;
+}
+
+static int parse_weight(const char *p, const char *end, double *res) {
+    char buffer[64];
+    size_t length = (size_t) (end - p);
+    if (length == 0 || length >= sizeof(buffer)) {
+        return 0;
+    }
+    memcpy(buffer, p, length);
+    buffer[length] = '\0';
+    char *last;
+    *res = strtod(buffer, &last);
+    return *last == '\0';
+}
+
+static int stream_parse_line(edgelist_stream_t *s, const char *p, const char *end) {
+    s->line++;
+    while (p < end && is_space(*p)) {
+        p++;
+    }
+    if (p == end || *p == '#') {
+        return STATUS_SUCCESS;
+    }
+
+    int u, v;
+    double w = 1.0;
+    const char *field_end = next_field(s, &p, end);
+    if (field_end == NULL || !parse_vertex(p, field_end, &u)) {
+        return stream_error(s, "Invalid source vertex");
+    }
+    p = field_end;
+    field_end = next_field(s, &p, end);
+    if (field_end == NULL || !parse_vertex(p, field_end, &v)) {
+        return stream_error(s, "Invalid target vertex");
+    }
+    p = field_end;
+    if (s->weighted) {
+        field_end = next_field(s, &p, end);
+        if (field_end != NULL && !parse_weight(p, field_end, &w)) {
+            return stream_error(s, "Invalid edge weight");
+        }
+    }
+    return stream_append(s, u, v, w);
+}
+
+static int stream_carry(edgelist_stream_t *s, const char *data, int size) {
+    if (s->carry_size + size > s->carry_capacity) {
+        int capacity = s->carry_capacity > 0 ? s->carry_capacity : 256;
+        while (capacity < s->carry_size + size) {
+            capacity *= 2;
+        }
+        char *carry = (char *) realloc(s->carry, capacity);
+        if (carry == NULL) {
+            return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        }
+        s->carry = carry;
+        s->carry_capacity = capacity;
+    }
+    memcpy(s->carry + s->carry_size, data, size);
+    s->carry_size += size;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_import_edgelist_stream_create(int directed, int weighted, char *delimiter, void** res) {
+    if (delimiter == NULL || strlen(delimiter) != 1) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Delimiter must be a single character");
+    }
+    edgelist_stream_t *s = (edgelist_stream_t *) calloc(1, sizeof(edgelist_stream_t));
+    if (s == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    s->directed = directed;
+    s->weighted = weighted;
+    s->delimiter = delimiter[0];
+    s->max_vertex = -1;
+    *res = s;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_import_edgelist_stream_destroy(void *h) {
+    edgelist_stream_t *s = (edgelist_stream_t *) h;
+    if (s == NULL) {
+        return STATUS_SUCCESS;
+    }
+    free(s->sources);
+    free(s->targets);
+    free(s->weights);
+    free(s->carry);
+    free(s);
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_import_edgelist_stream_push(void *h, char *data, int size) {
+    edgelist_stream_t *s = (edgelist_stream_t *) h;
+    if (s->finished) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Importer already finished");
+    }
+    const char *end = data + size;
+    const char *p = data;
+    const char *newline = (const char *) memchr(p, '\n', size);
+    if (newline == NULL) {
+        return stream_carry(s, data, size);
+    }
+
+    int status;
+    if (s->carry_size > 0) {
+        // complete the line left over from the previous block
+        if ((status = stream_carry(s, p, (int) (newline - p))) != STATUS_SUCCESS) {
+            return status;
+        }
+        status = stream_parse_line(s, s->carry, s->carry + s->carry_size);
+        s->carry_size = 0;
+        if (status != STATUS_SUCCESS) {
+            return status;
+        }
+        p = newline + 1;
+    }
+
+    while (p < end) {
+        newline = (const char *) memchr(p, '\n', end - p);
+        if (newline == NULL) {
+            return stream_carry(s, p, (int) (end - p));
+        }
+        if ((status = stream_parse_line(s, p, newline)) != STATUS_SUCCESS) {
+            return status;
+        }
+        p = newline + 1;
+    }
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_import_edgelist_stream_push_edges(void *h, int *sources, int sources_size, int *targets, int targets_size, 
+        double *weights, int weights_size) {
+    edgelist_stream_t *s = (edgelist_stream_t *) h;
+    if (s->finished) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Importer already finished");
+    }
+    if (sources_size != targets_size || (weights != NULL && weights_size != sources_size)) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Edge arrays must have the same length");
+    }
+    int status = stream_grow(s, sources_size);
+    for (int i = 0; i < sources_size && status == STATUS_SUCCESS; i++) {
+        if (sources[i] < 0 || targets[i] < 0) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative vertex identifier");
+        }
+        status = stream_append(s, sources[i], targets[i], weights != NULL ? weights[i] : 1.0);
+    }
+    return status;
+}
+
+int jgrapht_import_edgelist_stream_finish(void *h, int num_vertices, void** res) {
+    edgelist_stream_t *s = (edgelist_stream_t *) h;
+    if (s->finished) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Importer already finished");
+    }
+    int status;
+    if (s->carry_size > 0) {
+        status = stream_parse_line(s, s->carry, s->carry + s->carry_size);
+        s->carry_size = 0;
+        if (status != STATUS_SUCCESS) {
+            return status;
+        }
+    }
+    if (num_vertices < 0) {
+        num_vertices = s->max_vertex + 1;
+    } else if (num_vertices <= s->max_vertex) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Edge endpoint larger than the number of vertices");
+    }
+
+    // one call into the isolate per edge, see jgrapht_graph_sparse_create_from_arrays
+    status = jgrapht_graph_sparse_create_from_arrays(s->directed, s->weighted, num_vertices,
+            s->sources, s->size, s->targets, s->size, s->weights, s->weighted ? s->size : 0, res);
+
+    // the edges now live in the graph
+    s->finished = 1;
+    free(s->sources);
+    free(s->targets);
+    free(s->weights);
+    free(s->carry);
+    s->sources = s->targets = NULL;
+    s->weights = NULL;
+    s->carry = NULL;
+    s->size = s->capacity = s->carry_capacity = 0;
+    return status;
+}
+
+// Attribute columns. Importers report attributes through a callback which
+// receives the element, the key and the value as strings. Instead of calling
+// back into Python for each of them, the callbacks below append the values to
+// one column per key. Column types are inferred when the columns are read.
+
+typedef struct {
+    char *key;
+    int size;
+    int capacity;
+    int *ids;
+    size_t *starts;
+    char *pool;
+    size_t pool_size;
+    size_t pool_capacity;
+} attribute_column_t;
+
+typedef struct {
+    int count;
+    int capacity;
+    attribute_column_t *columns;
+    int last;
+    int failed;
+} attribute_columns_t;
+
+// columns receiving the vertex and the edge attributes of the import running
+// on this thread. The callbacks have no user data argument.
+static __thread attribute_columns_t *bound_columns[2] = { NULL, NULL };
+
+static attribute_column_t *columns_find(attribute_columns_t *cols, const char *key) {
+    // attributes of an element usually arrive in the same key order
+    for (int i = 0; i < cols->count; i++) {
+        int c = (cols->last + i) % cols->count;
+        if (strcmp(cols->columns[c].key, key) == 0) {
+            cols->last = c;
+            return cols->columns + c;
+        }
+    }
+    if (cols->count == cols->capacity) {
+        int capacity = cols->capacity > 0 ? 2 * cols->capacity : 8;
+        attribute_column_t *columns = (attribute_column_t *) realloc(cols->columns, sizeof(attribute_column_t) * capacity);
+        if (columns == NULL) {
+            return NULL;
+        }
+        cols->columns = columns;
+        cols->capacity = capacity;
+    }
+    attribute_column_t *column = cols->columns + cols->count;
+    memset(column, 0, sizeof(attribute_column_t));
+    column->key = strdup(key);
+    if (column->key == NULL) {
+        return NULL;
+    }
+    cols->last = cols->count++;
+    return column;
+}
+
+static int column_append(attribute_column_t *column, int id, const char *value) {
+    if (column->size == column->capacity) {
+        int capacity = column->capacity > 0 ? 2 * column->capacity : 64;
+        int *ids = (int *) realloc(column->ids, sizeof(int) * capacity);
+        if (ids == NULL) {
+            return 0;
+        }
+        column->ids = ids;
+        size_t *starts = (size_t *) realloc(column->starts, sizeof(size_t) * capacity);
+        if (starts == NULL) {
+            return 0;
+        }
+        column->starts = starts;
+        column->capacity = capacity;
+    }
+    size_t length = strlen(value) + 1;
+    if (column->pool_size + length > column->pool_capacity) {
+        size_t capacity = column->pool_capacity > 0 ? column->pool_capacity : 1024;
+        while (capacity < column->pool_size + length) {
+            capacity *= 2;
+        }
+        char *pool = (char *) realloc(column->pool, capacity);
+        if (pool == NULL) {
+            return 0;
+        }
+        column->pool = pool;
+        column->pool_capacity = capacity;
+    }
+    memcpy(column->pool + column->pool_size, value, length);
+    column->ids[column->size] = id;
+    column->starts[column->size] = column->pool_size;
+    column->pool_size += length;
+    column->size++;
+    return 1;
+}
+
+static void columns_put(attribute_columns_t *cols, int id, const char *key, const char *value) {
+    if (cols == NULL || cols->failed) {
+        return;
+    }
+    attribute_column_t *column = columns_find(cols, key);
+    if (column == NULL || !column_append(column, id, value)) {
+        cols->failed = 1;
+    }
+}
+
+static void vertex_columns_callback(int id, char *key, char *value) {
+    columns_put(bound_columns[0], id, key, value);
+}
+
+static void edge_columns_callback(int id, char *key, char *value) {
+    columns_put(bound_columns[1], id, key, value);
+}
+
+static int value_as_int(const char *value, int *res) {
+    char *last;
+    errno = 0;
+    long v = strtol(value, &last, 10);
+    if (last == value || *last != '\0' || errno != 0 || v < INT32_MIN || v > INT32_MAX) {
+        return 0;
+    }
+    *res = (int) v;
+    return 1;
+}
+
+static int value_as_double(const char *value, double *res) {
+    char *last;
+    *res = strtod(value, &last);
+    return last != value && *last == '\0';
+}
+
+static attribute_column_t *columns_get(void *h, int column) {
+    attribute_columns_t *cols = (attribute_columns_t *) h;
+    if (column < 0 || column >= cols->count) {
+        jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Column does not exist");
+        return NULL;
+    }
+    return cols->columns + column;
+}
+
+int jgrapht_attributes_columns_create(void** res) {
+    attribute_columns_t *cols = (attribute_columns_t *) calloc(1, sizeof(attribute_columns_t));
+    if (cols == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    *res = cols;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_destroy(void *h) {
+    attribute_columns_t *cols = (attribute_columns_t *) h;
+    if (cols == NULL) {
+        return STATUS_SUCCESS;
+    }
+    for (int i = 0; i < 2; i++) {
+        if (bound_columns[i] == cols) {
+            bound_columns[i] = NULL;
+        }
+    }
+    for (int i = 0; i < cols->count; i++) {
+        free(cols->columns[i].key);
+        free(cols->columns[i].ids);
+        free(cols->columns[i].starts);
+        free(cols->columns[i].pool);
+    }
+    free(cols->columns);
+    free(cols);
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_bind(void *h, int edges, long long *fptr) {
+    bound_columns[edges ? 1 : 0] = (attribute_columns_t *) h;
+    void (*callback)(int, char *, char *) = edges ? edge_columns_callback : vertex_columns_callback;
+    *fptr = (long long) (intptr_t) callback;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_count(void *h, int *res) {
+    attribute_columns_t *cols = (attribute_columns_t *) h;
+    if (cols->failed) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory for attributes");
+    }
+    *res = cols->count;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_key(void *h, int column, char **res) {
+    attribute_column_t *c = columns_get(h, column);
+    if (c == NULL) {
+        return STATUS_INDEX_OUT_OF_BOUNDS;
+    }
+    *res = c->key;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_info(void *h, int column, int *size, int *type, int *bytes) {
+    attribute_column_t *c = columns_get(h, column);
+    if (c == NULL) {
+        return STATUS_INDEX_OUT_OF_BOUNDS;
+    }
+    if (c->pool_size > INT32_MAX) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Column too large");
+    }
+    attribute_column_type_t t = ATTRIBUTE_COLUMN_INT;
+    int iv;
+    double dv;
+    for (int i = 0; i < c->size && t != ATTRIBUTE_COLUMN_STRING; i++) {
+        const char *value = c->pool + c->starts[i];
+        if (t == ATTRIBUTE_COLUMN_INT && !value_as_int(value, &iv)) {
+            t = ATTRIBUTE_COLUMN_DOUBLE;
+        }
+        if (t == ATTRIBUTE_COLUMN_DOUBLE && !value_as_double(value, &dv)) {
+            t = ATTRIBUTE_COLUMN_STRING;
+        }
+    }
+    *size = c->size;
+    *type = (int) t;
+    *bytes = (int) c->pool_size;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_ids(void *h, int column, int *ids, int ids_size) {
+    attribute_column_t *c = columns_get(h, column);
+    if (c == NULL) {
+        return STATUS_INDEX_OUT_OF_BOUNDS;
+    }
+    if (ids_size < c->size) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result array smaller than the column");
+    }
+    memcpy(ids, c->ids, sizeof(int) * c->size);
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_int_values(void *h, int column, int *values, int values_size) {
+    attribute_column_t *c = columns_get(h, column);
+    if (c == NULL) {
+        return STATUS_INDEX_OUT_OF_BOUNDS;
+    }
+    if (values_size < c->size) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result array smaller than the column");
+    }
+    for (int i = 0; i < c->size; i++) {
+        if (!value_as_int(c->pool + c->starts[i], values + i)) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Column value is not an integer");
+        }
+    }
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_double_values(void *h, int column, double *values, int values_size) {
+    attribute_column_t *c = columns_get(h, column);
+    if (c == NULL) {
+        return STATUS_INDEX_OUT_OF_BOUNDS;
+    }
+    if (values_size < c->size) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result array smaller than the column");
+    }
+    for (int i = 0; i < c->size; i++) {
+        if (!value_as_double(c->pool + c->starts[i], values + i)) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Column value is not a number");
+        }
+    }
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_attributes_columns_string_values(void *h, int column, char *buffer, int buffer_size) {
+    attribute_column_t *c = columns_get(h, column);
+    if (c == NULL) {
+        return STATUS_INDEX_OUT_OF_BOUNDS;
+    }
+    if ((size_t) buffer_size < c->pool_size) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result buffer smaller than the column");
+    }
+    memcpy(buffer, c->pool, c->pool_size);
+    return STATUS_SUCCESS;
+}
+
+// Parallel exporters. Vertices and edges are processed in rounds. In each
+// round the endpoints of the edges are read from the graph, chunks of the
+// round are formatted in parallel into separate buffers and the buffers are
+// written in order. Only formatting runs in the workers.
+
+#define EXPORT_CHUNK 16384
+#define EXPORT_MAX_ITEM 160
+
+typedef enum {
+    EXPORT_CSV_EDGE,
+    EXPORT_JSON_VERTEX,
+    EXPORT_JSON_EDGE,
+} export_item_t;
+
+typedef struct {
+    export_item_t item;
+    int weights;
+    int begin;
+    int count;
+    int *ids;
+    int *sources;
+    int *targets;
+    double *values;
+    char **buffers;
+    size_t *lengths;
+} export_round_t;
+
+// Same output as Double.toString in Java, which is what the isolate exporters
+// write, using the shortest representation which reads back exactly.
+static int format_double(char *buf, double value) {
+    if (value != value) {
+        return sprintf(buf, "NaN");
+    }
+    if (value == 1.0 / 0.0 || value == -1.0 / 0.0) {
+        return sprintf(buf, value > 0 ? "Infinity" : "-Infinity");
+    }
+    if (value == 0.0) {
+        return sprintf(buf, 1.0 / value < 0 ? "-0.0" : "0.0");
+    }
+
+    char digits[32];
+    int precision;
+    for (precision = 1; precision < 17; precision++) {
+        snprintf(digits, sizeof(digits), "%.*e", precision - 1, value);
+        if (strtod(digits, NULL) == value) {
+            break;
+        }
+    }
+    snprintf(digits, sizeof(digits), "%.*e", precision - 1, value);
+
+    // split "-d.ddde+x" into sign, significant digits and exponent
+    char *p = digits, *out = buf;
+    if (*p == '-') {
+        *out++ = *p++;
+    }
+    char significant[20];
+    int count = 0;
+    for (; *p != 'e'; p++) {
+        if (*p != '.') {
+            significant[count++] = *p;
+        }
+    }
+    int exponent = atoi(p + 1);
+    while (count > 1 && significant[count - 1] == '0') {
+        count--;
+    }
+
+    if (exponent >= -3 && exponent < 7) {
+        if (exponent < 0) {
+            out += sprintf(out, "0.");
+            for (int i = -1; i > exponent; i--) {
+                *out++ = '0';
+            }
+            memcpy(out, significant, count);
+            out += count;
+        } else {
+            for (int i = 0; i <= exponent; i++) {
+                *out++ = i < count ? significant[i] : '0';
+            }
+            *out++ = '.';
+            if (count > exponent + 1) {
+                memcpy(out, significant + exponent + 1, count - exponent - 1);
+                out += count - exponent - 1;
+            } else {
+                *out++ = '0';
+            }
+        }
+    } else {
+        *out++ = significant[0];
+        *out++ = '.';
+        if (count > 1) {
+            memcpy(out, significant + 1, count - 1);
+            out += count - 1;
+        } else {
+            *out++ = '0';
+        }
+        out += sprintf(out, "E%d", exponent);
+    }
+    *out = '\0';
+    return (int) (out - buf);
+}
+
+static int format_item(const export_round_t *r, int i, char *buf) {
+    int n = 0;
+    int index = r->begin + i;
+    switch (r->item) {
+    case EXPORT_CSV_EDGE:
+        n = sprintf(buf, "%d,%d", r->sources[i], r->targets[i]);
+        if (r->weights) {
+            buf[n++] = ',';
+            n += format_double(buf + n, r->values[i]);
+        }
+        buf[n++] = '\n';
+        break;
+    case EXPORT_JSON_VERTEX:
+        n = sprintf(buf, "%s{\"id\":\"%d\"}", index > 0 ? "," : "", r->ids[i]);
+        break;
+    case EXPORT_JSON_EDGE:
+        n = sprintf(buf, "%s{\"source\":\"%d\",\"target\":\"%d\"", index > 0 ? "," : "", r->sources[i], r->targets[i]);
+        if (r->weights && r->values[i] != 1.0) {
+            n += sprintf(buf + n, ",\"weight\":");
+            n += format_double(buf + n, r->values[i]);
+        }
+        buf[n++] = '}';
+        break;
+    }
+    return n;
+}
+
+static void export_round_body(void *arg, int worker, int chunk) {
+    (void) worker;
+    export_round_t *r = (export_round_t *) arg;
+    int begin = chunk * EXPORT_CHUNK;
+    int end = begin + EXPORT_CHUNK < r->count ? begin + EXPORT_CHUNK : r->count;
+    char *buf = r->buffers[chunk];
+    size_t length = 0;
+    for (int i = begin; i < end; i++) {
+        length += format_item(r, i, buf + length);
+    }
+    r->lengths[chunk] = length;
+}
+
+// Formats all items of one kind and writes them to the sink.
+static int export_items(void *g, export_item_t item, int weights, int *ids, int size, int threads, 
+        export_sink_t sink, void *sink_ctx) {
+    threads = jgrapht_parallel_threads(threads);
+    int chunks = 2 * threads;
+    int round_size = chunks * EXPORT_CHUNK;
+    int is_edge = item != EXPORT_JSON_VERTEX;
+    int status = STATUS_SUCCESS;
+
+    export_round_t r;
+    memset(&r, 0, sizeof(r));
+    r.item = item;
+    r.weights = weights;
+    r.buffers = (char **) calloc(chunks, sizeof(char *));
+    r.lengths = (size_t *) calloc(chunks, sizeof(size_t));
+    if (is_edge) {
+        r.sources = (int *) malloc(sizeof(int) * round_size);
+        r.targets = (int *) malloc(sizeof(int) * round_size);
+        if (weights) {
+            r.values = (double *) malloc(sizeof(double) * round_size);
+        }
+    }
+    int failed = r.buffers == NULL || r.lengths == NULL 
+        || (is_edge && (r.sources == NULL || r.targets == NULL || (weights && r.values == NULL)));
+    for (int c = 0; c < chunks && !failed; c++) {
+        r.buffers[c] = (char *) malloc(EXPORT_CHUNK * EXPORT_MAX_ITEM);
+        failed = r.buffers[c] == NULL;
+    }
+    if (failed) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+
+    for (r.begin = 0; r.begin < size && status == STATUS_SUCCESS; r.begin += round_size) {
+        r.count = size - r.begin < round_size ? size - r.begin : round_size;
+        r.ids = ids + r.begin;
+        if (is_edge) {
+            status = jgrapht_graph_edges_endpoints_array(g, r.ids, r.count, r.sources, r.count, 
+                r.targets, r.count, r.values, r.count);
+            if (status != STATUS_SUCCESS) {
+                break;
+            }
+        }
+        int round_chunks = (r.count + EXPORT_CHUNK - 1) / EXPORT_CHUNK;
+        jgrapht_parallel_for(round_chunks, round_chunks < threads ? round_chunks : threads, 1, export_round_body, &r);
+        for (int c = 0; c < round_chunks && status == STATUS_SUCCESS; c++) {
+            status = sink(sink_ctx, r.buffers[c], r.lengths[c]);
+        }
+    }
+
+    if (r.buffers != NULL) {
+        for (int c = 0; c < chunks; c++) {
+            free(r.buffers[c]);
+        }
+    }
+    free(r.buffers);
+    free(r.lengths);
+    free(r.sources);
+    free(r.targets);
+    free(r.values);
+    return status;
+}
+
+static int graph_ids(void *g, int vertices, int **res, int *size) {
+    int status = vertices ? jgrapht_graph_vertices_count(g, size) : jgrapht_graph_edges_count(g, size);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    *res = (int *) malloc(sizeof(int) * (*size + 1));
+    if (*res == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    int count;
+    status = vertices ? jgrapht_graph_vertices_array(g, *res, *size, &count) : jgrapht_graph_edges_array(g, *res, *size, &count);
+    if (status != STATUS_SUCCESS) {
+        free(*res);
+        *res = NULL;
+    }
+    return status;
+}
+
+// Same as the isolate exporter, weights are written whenever requested and
+// are 1.0 for unweighted graphs.
+static int export_csv_edgelist(void *g, int export_edge_weights, int threads, export_sink_t sink, void *sink_ctx) {
+    int *edges, m, status;
+    if ((status = graph_ids(g, 0, &edges, &m)) != STATUS_SUCCESS) {
+        return status;
+    }
+    status = export_items(g, EXPORT_CSV_EDGE, export_edge_weights != 0, edges, m, threads, sink, sink_ctx);
+    free(edges);
+    return status;
+}
+
+static int export_json(void *g, int threads, export_sink_t sink, void *sink_ctx) {
+    static const char *header = "{\"creator\":\"JGraphT JSON Exporter\",\"version\":\"1\",\"nodes\":[";
+    int *ids, size, weighted, status;
+    if ((status = jgrapht_graph_is_weighted(g, &weighted)) != STATUS_SUCCESS) {
+        return status;
+    }
+    if ((status = sink(sink_ctx, header, strlen(header))) != STATUS_SUCCESS) {
+        return status;
+    }
+    if ((status = graph_ids(g, 1, &ids, &size)) != STATUS_SUCCESS) {
+        return status;
+    }
+    status = export_items(g, EXPORT_JSON_VERTEX, 0, ids, size, threads, sink, sink_ctx);
+    free(ids);
+    if (status == STATUS_SUCCESS) {
+        status = sink(sink_ctx, "],\"edges\":[", 11);
+    }
+    if (status == STATUS_SUCCESS && (status = graph_ids(g, 0, &ids, &size)) == STATUS_SUCCESS) {
+        status = export_items(g, EXPORT_JSON_EDGE, weighted, ids, size, threads, sink, sink_ctx);
+        free(ids);
+    }
+    if (status == STATUS_SUCCESS) {
+        status = sink(sink_ctx, "]}", 2);
+    }
+    return status;
+}
+
+static int file_sink(void *f, const char *data, size_t size) {
+    if (size > 0 && fwrite(data, 1, size, (FILE *) f) != size) {
+        return jgrapht_error_set_errno(STATUS_IO_ERROR, "Failed to write file");
+    }
+    return STATUS_SUCCESS;
+}
+
+static FILE *open_export_file(const char *filename) {
+    FILE *f = fopen(filename, "wb");
+    if (f == NULL) {
+        jgrapht_error_set_errno(STATUS_IO_ERROR, "Failed to open file for writing");
+        return NULL;
+    }
+    // chunks are written as a whole, a large buffer avoids small writes
+    setvbuf(f, NULL, _IOFBF, 1 << 22);
+    return f;
+}
+
+static int close_export_file(FILE *f, int status) {
+    if (fclose(f) != 0 && status == STATUS_SUCCESS) {
+        status = jgrapht_error_set_errno(STATUS_IO_ERROR, "Failed to write file");
+    }
+    return status;
+}
+
+int jgrapht_export_file_csv_edgelist_parallel(void *g, char *filename, int export_edge_weights, int threads) {
+    FILE *f = open_export_file(filename);
+    if (f == NULL) {
+        return STATUS_IO_ERROR;
+    }
+    return close_export_file(f, export_csv_edgelist(g, export_edge_weights, threads, file_sink, f));
+}
+
+int jgrapht_export_file_json_parallel(void *g, char *filename, int threads) {
+    FILE *f = open_export_file(filename);
+    if (f == NULL) {
+        return STATUS_IO_ERROR;
+    }
+    return close_export_file(f, export_json(g, threads, file_sink, f));
+}
+
+int jgrapht_export_file_binary(void *g, char *filename) {
+    FILE *f = open_export_file(filename);
+    if (f == NULL) {
+        return STATUS_IO_ERROR;
+    }
+    return close_export_file(f, export_binary(g, file_sink, f));
+}
+
+// Exports to a caller provided sink, a function which receives the output in
+// chunks and returns zero on success. Chunks are valid only during the call.
+
+typedef int (*export_sink_fptr_t)(const char *, long long);
+
+#define EXPORT_SINK_CHUNK (1 << 20)
+
+static int fptr_sink(void *ctx, const char *data, size_t size) {
+    export_sink_fptr_t sink = (export_sink_fptr_t) ctx;
+    while (size > 0) {
+        size_t length = size < EXPORT_SINK_CHUNK ? size : EXPORT_SINK_CHUNK;
+        if (sink(data, (long long) length) != 0) {
+            return jgrapht_error_set_errno(STATUS_EXPORT_ERROR, "Failed to write to sink");
+        }
+        data += length;
+        size -= length;
+    }
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_export_sink_csv_edgelist_parallel(void *g, int export_edge_weights, int threads, void *sink) {
+    return export_csv_edgelist(g, export_edge_weights, threads, fptr_sink, sink);
+}
+
+int jgrapht_export_sink_json_parallel(void *g, int threads, void *sink) {
+    return export_json(g, threads, fptr_sink, sink);
+}
+
+int jgrapht_export_sink_binary(void *g, void *sink) {
+    return export_binary(g, fptr_sink, sink);
+}
+
+int jgrapht_export_sink_string(void *string_handle, void *sink) {
+    char *value;
+    int status = jgrapht_handles_get_ccharpointer(string_handle, &value);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    return fptr_sink(sink, value, strlen(value));
+}
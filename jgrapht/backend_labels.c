@@ -0,0 +1,272 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Dense vertex labelings computed in parallel on a csr snapshot of the graph,
+// weakly connected components and label propagation clustering. Labels are
+// written by vertex position and numbered 0, 1, ... in the order in which
+// the labels first appear in the vertex set of the graph.
+
+// replaces labels, which are vertex positions, by their dense numbering
+static int dense_labels(int n, int *labels, int *count) {
+    int *ids = malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (ids == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    memset(ids, -1, sizeof(int) * n);
+    int next = 0;
+    for (int v = 0; v < n; v++) {
+        int l = labels[v];
+        if (ids[l] == -1) {
+            ids[l] = next++;
+        }
+        labels[v] = ids[l];
+    }
+    free(ids);
+    *count = next;
+    return STATUS_SUCCESS;
+}
+
+// weakly connected components using a concurrent union-find, roots are always
+// linked to a smaller root, thus parents only decrease and the root of a
+// component is its first vertex
+
+typedef struct {
+    const jgrapht_csr_t *csr;
+    int *parent;
+} wcc_ctx_t;
+
+static int uf_find(int *parent, int v) {
+    for (;;) {
+        int p = __atomic_load_n(&parent[v], __ATOMIC_RELAXED);
+        if (p == v) {
+            return v;
+        }
+        int gp = __atomic_load_n(&parent[p], __ATOMIC_RELAXED);
+        if (gp != p) {
+            // path halving, a failure only means that another thread did it
+            __atomic_compare_exchange_n(&parent[v], &p, gp, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+        v = gp;
+    }
+}
+
+static void uf_union(int *parent, int u, int v) {
+    for (;;) {
+        u = uf_find(parent, u);
+        v = uf_find(parent, v);
+        if (u == v) {
+            return;
+        }
+        if (u < v) {
+            int t = u;
+            u = v;
+            v = t;
+        }
+        int expected = u;
+        if (__atomic_compare_exchange_n(&parent[u], &expected, v, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return;
+        }
+    }
+}
+
+static void wcc_union_body(void *arg, int worker, int u) {
+    wcc_ctx_t *ctx = (wcc_ctx_t *) arg;
+    const jgrapht_csr_t *csr = ctx->csr;
+    (void) worker;
+    for (int k = csr->out_offsets[u]; k < csr->out_offsets[u + 1]; k++) {
+        uf_union(ctx->parent, u, csr->out_targets[k]);
+    }
+}
+
+static void wcc_find_body(void *arg, int worker, int v) {
+    wcc_ctx_t *ctx = (wcc_ctx_t *) arg;
+    (void) worker;
+    __atomic_store_n(&ctx->parent[v], uf_find(ctx->parent, v), __ATOMIC_RELAXED);
+}
+
+int jgrapht_connectivity_weak_exec_parallel(void *g, int threads, int *components, int components_size, int* res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = csr->n;
+    if (components_size < n) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Array smaller than the number of vertices");
+    }
+    threads = jgrapht_parallel_threads(threads);
+    wcc_ctx_t ctx = { csr, components };
+    for (int v = 0; v < n; v++) {
+        components[v] = v;
+    }
+    jgrapht_parallel_for(n, threads, 1024, wcc_union_body, &ctx);
+    jgrapht_parallel_for(n, threads, 1024, wcc_find_body, &ctx);
+    status = dense_labels(n, components, res);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
+
+// asynchronous label propagation, see "Near linear time algorithm to detect
+// community structures in large-scale networks", U. N. Raghavan, R. Albert and
+// S. Kumara, 2007. Every iteration visits the vertices in a random order and
+// moves each one to a label carried by most of its neighbors, reading the
+// labels as they are updated by the other threads. The iterations stop once
+// every vertex carries such a label. Concurrent updates may keep ties
+// flipping between threads, thus without a limit from the caller at most
+// LP_MAX_ITERATIONS iterations are run.
+
+#define LP_MAX_ITERATIONS 1000
+
+typedef struct {
+    int *scratch;
+    unsigned long long state;
+} lp_worker_t;
+
+typedef struct {
+    const jgrapht_csr_t *csr;
+    int *order;
+    int *labels;
+    lp_worker_t *workers;
+    int changed;
+} lp_ctx_t;
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+static int lp_gather(const int *offsets, const int *neighbors, const int *labels, int v, int *scratch, int size) {
+    for (int k = offsets[v]; k < offsets[v + 1]; k++) {
+        int u = neighbors[k];
+        if (u != v) {
+            scratch[size++] = __atomic_load_n(&labels[u], __ATOMIC_RELAXED);
+        }
+    }
+    return size;
+}
+
+static void lp_body(void *arg, int worker, int item) {
+    lp_ctx_t *ctx = (lp_ctx_t *) arg;
+    const jgrapht_csr_t *csr = ctx->csr;
+    lp_worker_t *w = ctx->workers + worker;
+    int v = ctx->order[item];
+
+    int size = lp_gather(csr->out_offsets, csr->out_targets, ctx->labels, v, w->scratch, 0);
+    if (csr->directed) {
+        size = lp_gather(csr->in_offsets, csr->in_sources, ctx->labels, v, w->scratch, size);
+    }
+    if (size == 0) {
+        return;
+    }
+    qsort(w->scratch, size, sizeof(int), compare_int);
+
+    // the current label wins if it is among the most frequent ones, otherwise
+    // one of them is chosen uniformly at random
+    int current = ctx->labels[v];
+    int best = 0, ties = 0, chosen = current, keep = 0;
+    for (int begin = 0; begin < size;) {
+        int end = begin + 1;
+        while (end < size && w->scratch[end] == w->scratch[begin]) {
+            end++;
+        }
+        int frequency = end - begin;
+        int label = w->scratch[begin];
+        if (frequency > best) {
+            best = frequency;
+            ties = 1;
+            chosen = label;
+            keep = label == current;
+        } else if (frequency == best) {
+            ties++;
+            if (jgrapht_random_int(&w->state, ties) == 0) {
+                chosen = label;
+            }
+            keep = keep || label == current;
+        }
+        begin = end;
+    }
+    if (!keep) {
+        __atomic_store_n(&ctx->labels[v], chosen, __ATOMIC_RELAXED);
+        __atomic_store_n(&ctx->changed, 1, __ATOMIC_RELAXED);
+    }
+}
+
+int jgrapht_clustering_exec_label_propagation_parallel(void *g, int max_iterations, long long int seed, int threads,
+        int *labels, int labels_size, int* res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = csr->n;
+    if (labels_size < n) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Array smaller than the number of vertices");
+    }
+    threads = jgrapht_parallel_threads(threads);
+    int max_degree = 0;
+    for (int v = 0; v < n; v++) {
+        int degree = csr->out_offsets[v + 1] - csr->out_offsets[v];
+        if (csr->directed) {
+            degree += csr->in_offsets[v + 1] - csr->in_offsets[v];
+        }
+        if (degree > max_degree) {
+            max_degree = degree;
+        }
+    }
+    lp_ctx_t ctx;
+    memset(&ctx, 0, sizeof(lp_ctx_t));
+    ctx.csr = csr;
+    ctx.labels = labels;
+    ctx.order = malloc(sizeof(int) * (n > 0 ? n : 1));
+    ctx.workers = calloc(threads, sizeof(lp_worker_t));
+    if (ctx.order == NULL || ctx.workers == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        goto cleanup;
+    }
+    unsigned long long state = (unsigned long long) seed;
+    for (int i = 0; i < threads; i++) {
+        ctx.workers[i].state = jgrapht_random_next(&state);
+        if ((ctx.workers[i].scratch = malloc(sizeof(int) * (max_degree > 0 ? max_degree : 1))) == NULL) {
+            status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+            goto cleanup;
+        }
+    }
+    for (int v = 0; v < n; v++) {
+        labels[v] = v;
+        ctx.order[v] = v;
+    }
+
+    if (max_iterations <= 0) {
+        max_iterations = LP_MAX_ITERATIONS;
+    }
+    for (int iteration = 0; iteration < max_iterations; iteration++) {
+        for (int i = n - 1; i > 0; i--) {
+            int j = jgrapht_random_int(&state, i + 1);
+            int t = ctx.order[i];
+            ctx.order[i] = ctx.order[j];
+            ctx.order[j] = t;
+        }
+        ctx.changed = 0;
+        jgrapht_parallel_for(n, threads, 256, lp_body, &ctx);
+        if (!ctx.changed) {
+            break;
+        }
+    }
+    status = dense_labels(n, labels, res);
+
+cleanup:
+    if (ctx.workers != NULL) {
+        for (int i = 0; i < threads; i++) {
+            free(ctx.workers[i].scratch);
+        }
+    }
+    free(ctx.workers);
+    free(ctx.order);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
@@ -0,0 +1,699 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Triangle counts and clustering coefficients of undirected graphs, either
+// maintained while the graph is modified or recomputed in parallel. Both work
+// on the simple graph underlying the input, self-loops are ignored and
+// multiple edges between two vertices count once.
+
+// open addressing int to int map, keys are non-negative
+
+#define MAP_EMPTY -1
+#define MAP_DELETED -2
+
+typedef struct {
+    int *keys;
+    int *values;
+    int size;
+    int used;
+    int capacity;
+} int_map_t;
+
+static unsigned int map_hash(int key) {
+    unsigned int h = (unsigned int) key;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+static void map_destroy(int_map_t *map) {
+    free(map->keys);
+    free(map->values);
+    memset(map, 0, sizeof(int_map_t));
+}
+
+static int map_find(const int_map_t *map, int key) {
+    if (map->capacity == 0) {
+        return -1;
+    }
+    unsigned int mask = map->capacity - 1;
+    unsigned int h = map_hash(key) & mask;
+    while (map->keys[h] != MAP_EMPTY) {
+        if (map->keys[h] == key) {
+            return (int) h;
+        }
+        h = (h + 1) & mask;
+    }
+    return -1;
+}
+
+static int map_get(const int_map_t *map, int key, int missing) {
+    int slot = map_find(map, key);
+    return slot == -1 ? missing : map->values[slot];
+}
+
+static int map_rehash(int_map_t *map, int capacity) {
+    int *keys = malloc(sizeof(int) * capacity);
+    int *values = malloc(sizeof(int) * capacity);
+    if (keys == NULL || values == NULL) {
+        free(keys);
+        free(values);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    memset(keys, MAP_EMPTY, sizeof(int) * capacity);
+    unsigned int mask = capacity - 1;
+    for (int i = 0; i < map->capacity; i++) {
+        if (map->keys[i] >= 0) {
+            unsigned int h = map_hash(map->keys[i]) & mask;
+            while (keys[h] != MAP_EMPTY) {
+                h = (h + 1) & mask;
+            }
+            keys[h] = map->keys[i];
+            values[h] = map->values[i];
+        }
+    }
+    free(map->keys);
+    free(map->values);
+    map->keys = keys;
+    map->values = values;
+    map->used = map->size;
+    map->capacity = capacity;
+    return STATUS_SUCCESS;
+}
+
+static int map_put(int_map_t *map, int key, int value) {
+    int slot = map_find(map, key);
+    if (slot != -1) {
+        map->values[slot] = value;
+        return STATUS_SUCCESS;
+    }
+    if (4 * (map->used + 1) > 3 * map->capacity) {
+        // deleted entries are dropped when the map does not need to grow
+        int capacity = map->capacity == 0 ? 4 : map->capacity;
+        while (2 * (map->size + 1) > capacity) {
+            capacity <<= 1;
+        }
+        int status;
+        if ((status = map_rehash(map, capacity)) != STATUS_SUCCESS) {
+            return status;
+        }
+    }
+    unsigned int mask = map->capacity - 1;
+    unsigned int h = map_hash(key) & mask;
+    while (map->keys[h] >= 0) {
+        h = (h + 1) & mask;
+    }
+    if (map->keys[h] == MAP_EMPTY) {
+        map->used++;
+    }
+    map->keys[h] = key;
+    map->values[h] = value;
+    map->size++;
+    return STATUS_SUCCESS;
+}
+
+static void map_remove(int_map_t *map, int key) {
+    int slot = map_find(map, key);
+    if (slot != -1) {
+        map->keys[slot] = MAP_DELETED;
+        map->size--;
+    }
+}
+
+// maintained metrics, every tracker is registered for its graph and the graph
+// functions of the backend report each successful modification
+
+typedef struct {
+    // neighbor to number of edges between the two vertices
+    int_map_t neighbors;
+    long long triangles;
+} tracked_vertex_t;
+
+typedef struct metrics_tracker {
+    void *graph;
+    int_map_t vertex_slots;
+    tracked_vertex_t *slots;
+    int slots_count;
+    int slots_capacity;
+    int *free_slots;
+    int free_slots_count;
+    int_map_t edge_sources;
+    int_map_t edge_targets;
+    long long triangles;
+    // paths of length two, the denominator of the global clustering coefficient
+    long long triplets;
+    int failed;
+    struct metrics_tracker *next;
+} metrics_tracker_t;
+
+static pthread_mutex_t trackers_lock = PTHREAD_MUTEX_INITIALIZER;
+static metrics_tracker_t *trackers = NULL;
+static int trackers_count = 0;
+
+// Views created by the backend and the graph they were created from. A view
+// and its graph share their vertices and edges, thus trackers are keyed by
+// the graph at the root of a chain of views and changes made through any
+// view of it reach them.
+typedef struct graph_view {
+    void *view;
+    void *graph;
+    struct graph_view *next;
+} graph_view_t;
+
+static graph_view_t *views = NULL;
+static int views_count = 0;
+
+// must be called with the lock held
+static void *listeners_root(void *g) {
+    for (graph_view_t *w = views; w != NULL;) {
+        if (w->view == g) {
+            g = w->graph;
+            w = views;
+        } else {
+            w = w->next;
+        }
+    }
+    return g;
+}
+
+static int tracker_slot(metrics_tracker_t *tr, int v) {
+    int slot = map_get(&tr->vertex_slots, v, -1);
+    if (slot != -1) {
+        return slot;
+    }
+    if (tr->free_slots_count > 0) {
+        slot = tr->free_slots[--tr->free_slots_count];
+    } else {
+        if (tr->slots_count == tr->slots_capacity) {
+            int capacity = tr->slots_capacity == 0 ? 16 : 2 * tr->slots_capacity;
+            tracked_vertex_t *slots = realloc(tr->slots, sizeof(tracked_vertex_t) * capacity);
+            int *free_slots = realloc(tr->free_slots, sizeof(int) * capacity);
+            if (slots != NULL) {
+                tr->slots = slots;
+            }
+            if (free_slots != NULL) {
+                tr->free_slots = free_slots;
+            }
+            if (slots == NULL || free_slots == NULL) {
+                return -1;
+            }
+            tr->slots_capacity = capacity;
+        }
+        slot = tr->slots_count++;
+    }
+    memset(&tr->slots[slot], 0, sizeof(tracked_vertex_t));
+    if (map_put(&tr->vertex_slots, v, slot) != STATUS_SUCCESS) {
+        tr->free_slots[tr->free_slots_count++] = slot;
+        return -1;
+    }
+    return slot;
+}
+
+// vertices adjacent to both, every one of them closes a triangle
+static long long tracker_common(metrics_tracker_t *tr, tracked_vertex_t *a, tracked_vertex_t *b, int delta) {
+    if (a->neighbors.size > b->neighbors.size) {
+        tracked_vertex_t *t = a;
+        a = b;
+        b = t;
+    }
+    long long common = 0;
+    for (int i = 0; i < a->neighbors.capacity; i++) {
+        int w = a->neighbors.keys[i];
+        if (w >= 0 && map_find(&b->neighbors, w) != -1) {
+            tr->slots[map_get(&tr->vertex_slots, w, -1)].triangles += delta;
+            common++;
+        }
+    }
+    return common;
+}
+
+static void tracker_add_edge(metrics_tracker_t *tr, int e, int u, int v) {
+    if (map_put(&tr->edge_sources, e, u) != STATUS_SUCCESS || map_put(&tr->edge_targets, e, v) != STATUS_SUCCESS) {
+        tr->failed = 1;
+        return;
+    }
+    if (u == v) {
+        return;
+    }
+    int su = tracker_slot(tr, u), sv = tracker_slot(tr, v);
+    if (su == -1 || sv == -1) {
+        tr->failed = 1;
+        return;
+    }
+    tracked_vertex_t *a = &tr->slots[su], *b = &tr->slots[sv];
+    int count = map_get(&a->neighbors, v, 0);
+    if (count == 0) {
+        long long common = tracker_common(tr, a, b, 1);
+        a->triangles += common;
+        b->triangles += common;
+        tr->triangles += common;
+        tr->triplets += a->neighbors.size + b->neighbors.size;
+    }
+    if (map_put(&a->neighbors, v, count + 1) != STATUS_SUCCESS || map_put(&b->neighbors, u, count + 1) != STATUS_SUCCESS) {
+        tr->failed = 1;
+    }
+}
+
+static void tracker_remove_edge(metrics_tracker_t *tr, int e) {
+    int u = map_get(&tr->edge_sources, e, -1);
+    int v = map_get(&tr->edge_targets, e, -1);
+    if (u == -1) {
+        return;
+    }
+    map_remove(&tr->edge_sources, e);
+    map_remove(&tr->edge_targets, e);
+    if (u == v) {
+        return;
+    }
+    tracked_vertex_t *a = &tr->slots[map_get(&tr->vertex_slots, u, -1)];
+    tracked_vertex_t *b = &tr->slots[map_get(&tr->vertex_slots, v, -1)];
+    int count = map_get(&a->neighbors, v, 0);
+    if (count > 1) {
+        map_put(&a->neighbors, v, count - 1);
+        map_put(&b->neighbors, u, count - 1);
+        return;
+    }
+    map_remove(&a->neighbors, v);
+    map_remove(&b->neighbors, u);
+    long long common = tracker_common(tr, a, b, -1);
+    a->triangles -= common;
+    b->triangles -= common;
+    tr->triangles -= common;
+    tr->triplets -= a->neighbors.size + b->neighbors.size;
+}
+
+static void tracker_remove_vertex(metrics_tracker_t *tr, int v) {
+    int slot = map_get(&tr->vertex_slots, v, -1);
+    if (slot == -1) {
+        return;
+    }
+    // the edges of the vertex are only known by scanning all of them
+    for (int i = 0; i < tr->edge_sources.capacity; i++) {
+        int e = tr->edge_sources.keys[i];
+        if (e >= 0 && (tr->edge_sources.values[i] == v || map_get(&tr->edge_targets, e, -1) == v)) {
+            tracker_remove_edge(tr, e);
+        }
+    }
+    map_destroy(&tr->slots[slot].neighbors);
+    map_remove(&tr->vertex_slots, v);
+    tr->free_slots[tr->free_slots_count++] = slot;
+}
+
+static void tracker_free(metrics_tracker_t *tr) {
+    for (int i = 0; i < tr->slots_count; i++) {
+        map_destroy(&tr->slots[i].neighbors);
+    }
+    free(tr->slots);
+    free(tr->free_slots);
+    map_destroy(&tr->vertex_slots);
+    map_destroy(&tr->edge_sources);
+    map_destroy(&tr->edge_targets);
+    free(tr);
+}
+
+void jgrapht_graph_listeners_vertex_added(void *g, int v) {
+    if (__atomic_load_n(&trackers_count, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+    pthread_mutex_lock(&trackers_lock);
+    g = listeners_root(g);
+    for (metrics_tracker_t *tr = trackers; tr != NULL; tr = tr->next) {
+        if (tr->graph == g && tracker_slot(tr, v) == -1) {
+            tr->failed = 1;
+        }
+    }
+    pthread_mutex_unlock(&trackers_lock);
+}
+
+void jgrapht_graph_listeners_vertex_removed(void *g, int v) {
+    if (__atomic_load_n(&trackers_count, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+    pthread_mutex_lock(&trackers_lock);
+    g = listeners_root(g);
+    for (metrics_tracker_t *tr = trackers; tr != NULL; tr = tr->next) {
+        if (tr->graph == g) {
+            tracker_remove_vertex(tr, v);
+        }
+    }
+    pthread_mutex_unlock(&trackers_lock);
+}
+
+void jgrapht_graph_listeners_edge_added(void *g, int e, int u, int v) {
+    if (__atomic_load_n(&trackers_count, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+    pthread_mutex_lock(&trackers_lock);
+    g = listeners_root(g);
+    for (metrics_tracker_t *tr = trackers; tr != NULL; tr = tr->next) {
+        if (tr->graph == g) {
+            tracker_add_edge(tr, e, u, v);
+        }
+    }
+    pthread_mutex_unlock(&trackers_lock);
+}
+
+// Changes made inside the isolate, such as by importers and generators, are
+// not reported one by one, thus the trackers of the graph become out of date.
+void jgrapht_graph_listeners_changed(void *g) {
+    if (__atomic_load_n(&trackers_count, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+    pthread_mutex_lock(&trackers_lock);
+    g = listeners_root(g);
+    for (metrics_tracker_t *tr = trackers; tr != NULL; tr = tr->next) {
+        if (tr->graph == g) {
+            tr->failed = 1;
+        }
+    }
+    pthread_mutex_unlock(&trackers_lock);
+}
+
+void jgrapht_graph_listeners_view_created(void *view, void *g) {
+    graph_view_t *w = malloc(sizeof(graph_view_t));
+    if (w == NULL) {
+        // without the link changes through the view are not tracked
+        return;
+    }
+    w->view = view;
+    w->graph = g;
+    pthread_mutex_lock(&trackers_lock);
+    w->next = views;
+    views = w;
+    __atomic_add_fetch(&views_count, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&trackers_lock);
+}
+
+void jgrapht_graph_listeners_view_destroyed(void *view) {
+    if (__atomic_load_n(&views_count, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+    pthread_mutex_lock(&trackers_lock);
+    for (graph_view_t **p = &views; *p != NULL; p = &(*p)->next) {
+        graph_view_t *w = *p;
+        if (w->view == view) {
+            *p = w->next;
+            __atomic_sub_fetch(&views_count, 1, __ATOMIC_RELEASE);
+            free(w);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&trackers_lock);
+}
+
+void jgrapht_graph_listeners_edge_removed(void *g, int e) {
+    if (__atomic_load_n(&trackers_count, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+    pthread_mutex_lock(&trackers_lock);
+    g = listeners_root(g);
+    for (metrics_tracker_t *tr = trackers; tr != NULL; tr = tr->next) {
+        if (tr->graph == g) {
+            tracker_remove_edge(tr, e);
+        }
+    }
+    pthread_mutex_unlock(&trackers_lock);
+}
+
+// Creates a tracker from the current state of an undirected graph. Changes
+// made through the graph functions of the backend are applied to the tracker
+// until it is destroyed. The initial count inserts the edges one at a time,
+// intersecting the smaller neighborhood with the larger one.
+int jgrapht_graph_metrics_tracker_create(void *g, void** res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    if (csr->directed) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Graph must be undirected");
+    }
+    metrics_tracker_t *tr = calloc(1, sizeof(metrics_tracker_t));
+    if (tr == NULL) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    pthread_mutex_lock(&trackers_lock);
+    tr->graph = listeners_root(g);
+    pthread_mutex_unlock(&trackers_lock);
+    for (int u = 0; u < csr->n && !tr->failed; u++) {
+        if (tracker_slot(tr, csr->vertices[u]) == -1) {
+            tr->failed = 1;
+        }
+    }
+    for (int u = 0; u < csr->n && !tr->failed; u++) {
+        for (int k = csr->out_offsets[u]; k < csr->out_offsets[u + 1]; k++) {
+            // undirected edges are seen from both endpoints
+            int v = csr->out_targets[k];
+            if (u <= v) {
+                tracker_add_edge(tr, csr->out_edges[k], csr->vertices[u], csr->vertices[v]);
+            }
+        }
+    }
+    jgrapht_csr_destroy(csr);
+    if (tr->failed) {
+        tracker_free(tr);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+
+    pthread_mutex_lock(&trackers_lock);
+    tr->next = trackers;
+    trackers = tr;
+    __atomic_add_fetch(&trackers_count, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&trackers_lock);
+    *res = tr;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_graph_metrics_tracker_destroy(void *handle) {
+    metrics_tracker_t *tr = (metrics_tracker_t *) handle;
+    if (tr == NULL) {
+        return STATUS_SUCCESS;
+    }
+    pthread_mutex_lock(&trackers_lock);
+    for (metrics_tracker_t **p = &trackers; *p != NULL; p = &(*p)->next) {
+        if (*p == tr) {
+            *p = tr->next;
+            __atomic_sub_fetch(&trackers_count, 1, __ATOMIC_RELEASE);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&trackers_lock);
+    tracker_free(tr);
+    return STATUS_SUCCESS;
+}
+
+// must be called with the lock held
+static int tracker_check(metrics_tracker_t *tr) {
+    if (tr->failed) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Metrics out of date after a failed or untracked update");
+    }
+    return STATUS_SUCCESS;
+}
+
+static double local_coefficient(const tracked_vertex_t *x) {
+    long long d = x->neighbors.size;
+    return d < 2 ? 0.0 : 2.0 * x->triangles / (d * (d - 1));
+}
+
+int jgrapht_graph_metrics_tracker_triangles(void *handle, long long int* res) {
+    metrics_tracker_t *tr = (metrics_tracker_t *) handle;
+    pthread_mutex_lock(&trackers_lock);
+    int status = tracker_check(tr);
+    if (status == STATUS_SUCCESS) {
+        *res = tr->triangles;
+    }
+    pthread_mutex_unlock(&trackers_lock);
+    return status;
+}
+
+// the number of edges between neighbors of each vertex and its local
+// clustering coefficient, for the given vertices
+int jgrapht_graph_metrics_tracker_vertices(void *handle, int *vertices, int vertices_size,
+        long long int *triangles, int triangles_size, double *coefficients, int coefficients_size) {
+    metrics_tracker_t *tr = (metrics_tracker_t *) handle;
+    if ((triangles != NULL && triangles_size < vertices_size) || (coefficients != NULL && coefficients_size < vertices_size)) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result arrays smaller than the vertices");
+    }
+    pthread_mutex_lock(&trackers_lock);
+    int status = tracker_check(tr);
+    for (int i = 0; i < vertices_size && status == STATUS_SUCCESS; i++) {
+        int slot = map_get(&tr->vertex_slots, vertices[i], -1);
+        if (slot == -1) {
+            status = jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Vertex not in graph");
+            break;
+        }
+        if (triangles != NULL) {
+            triangles[i] = tr->slots[slot].triangles;
+        }
+        if (coefficients != NULL) {
+            coefficients[i] = local_coefficient(&tr->slots[slot]);
+        }
+    }
+    pthread_mutex_unlock(&trackers_lock);
+    return status;
+}
+
+// global clustering coefficient (transitivity) and average of the local
+// clustering coefficients, where vertices with degree less than two count as
+// zero
+int jgrapht_graph_metrics_tracker_clustering(void *handle, double* global_res, double* average_res) {
+    metrics_tracker_t *tr = (metrics_tracker_t *) handle;
+    pthread_mutex_lock(&trackers_lock);
+    int status = tracker_check(tr);
+    if (status == STATUS_SUCCESS) {
+        *global_res = tr->triplets == 0 ? 0.0 : 3.0 * tr->triangles / tr->triplets;
+        double sum = 0.0;
+        for (int i = 0; i < tr->vertex_slots.capacity; i++) {
+            if (tr->vertex_slots.keys[i] >= 0) {
+                sum += local_coefficient(&tr->slots[tr->vertex_slots.values[i]]);
+            }
+        }
+        *average_res = tr->vertex_slots.size == 0 ? 0.0 : sum / tr->vertex_slots.size;
+    }
+    pthread_mutex_unlock(&trackers_lock);
+    return status;
+}
+
+// Full recount in parallel. Every edge is oriented from the endpoint with the
+// smaller degree to the other, so each triangle is found once at its lowest
+// vertex by intersecting two sorted forward neighborhoods of size at most
+// sqrt(2m).
+
+typedef struct {
+    const int *offsets;
+    const int *forward;
+    long long *counts;
+} triangles_ctx_t;
+
+// branchless merge, or binary searches when one side is much longer
+static long long intersect_count(const int *a, int na, const int *b, int nb) {
+    if (na > nb) {
+        const int *t = a;
+        a = b;
+        b = t;
+        int tn = na;
+        na = nb;
+        nb = tn;
+    }
+    long long count = 0;
+    if (na * 32 < nb) {
+        int lo = 0;
+        for (int i = 0; i < na; i++) {
+            int hi = nb;
+            while (lo < hi) {
+                int mid = lo + (hi - lo) / 2;
+                if (b[mid] < a[i]) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            count += lo < nb && b[lo] == a[i];
+        }
+        return count;
+    }
+    int i = 0, j = 0;
+    while (i < na && j < nb) {
+        int x = a[i], y = b[j];
+        count += x == y;
+        i += x <= y;
+        j += y <= x;
+    }
+    return count;
+}
+
+static void triangles_body(void *arg, int worker, int v) {
+    triangles_ctx_t *ctx = (triangles_ctx_t *) arg;
+    const int *fv = ctx->forward + ctx->offsets[v];
+    int nv = ctx->offsets[v + 1] - ctx->offsets[v];
+    long long count = 0;
+    for (int k = 0; k < nv; k++) {
+        int w = fv[k];
+        count += intersect_count(fv, nv, ctx->forward + ctx->offsets[w], ctx->offsets[w + 1] - ctx->offsets[w]);
+    }
+    // one counter per cache line
+    ctx->counts[8 * worker] += count;
+}
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+int jgrapht_graph_metrics_triangles_parallel(void *g, int threads, long long int* res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    if (csr->directed) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Graph must be undirected");
+    }
+    threads = jgrapht_parallel_threads(threads);
+    int n = csr->n, arcs = csr->out_offsets[n];
+    int *degree = malloc(sizeof(int) * (n > 0 ? n : 1));
+    int *offsets = malloc(sizeof(int) * (n + 1));
+    int *forward = malloc(sizeof(int) * (arcs > 0 ? arcs : 1));
+    long long *counts = calloc(8 * threads, sizeof(long long));
+    if (degree == NULL || offsets == NULL || forward == NULL || counts == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        goto cleanup;
+    }
+
+    // distinct neighbors, sorted
+    for (int v = 0; v < n; v++) {
+        int begin = csr->out_offsets[v], size = 0;
+        for (int k = begin; k < csr->out_offsets[v + 1]; k++) {
+            if (csr->out_targets[k] != v) {
+                forward[begin + size++] = csr->out_targets[k];
+            }
+        }
+        qsort(forward + begin, size, sizeof(int), compare_int);
+        int unique = 0;
+        for (int k = 0; k < size; k++) {
+            if (unique == 0 || forward[begin + unique - 1] != forward[begin + k]) {
+                forward[begin + unique++] = forward[begin + k];
+            }
+        }
+        degree[v] = unique;
+    }
+    // keep the arcs towards larger degrees and compact them
+    int next = 0;
+    for (int v = 0; v < n; v++) {
+        int begin = csr->out_offsets[v];
+        offsets[v] = next;
+        for (int k = 0; k < degree[v]; k++) {
+            int w = forward[begin + k];
+            if (degree[w] > degree[v] || (degree[w] == degree[v] && w > v)) {
+                forward[next++] = w;
+            }
+        }
+    }
+    offsets[n] = next;
+
+    triangles_ctx_t ctx = { offsets, forward, counts };
+    jgrapht_parallel_for(n, threads, 256, triangles_body, &ctx);
+    long long total = 0;
+    for (int i = 0; i < threads; i++) {
+        total += counts[8 * i];
+    }
+    *res = total;
+
+cleanup:
+    free(degree);
+    free(offsets);
+    free(forward);
+    free(counts);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
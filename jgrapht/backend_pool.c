@@ -0,0 +1,75 @@
+#include <stdlib.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Pooled iterators keep the same handle across loops, only the iterator of
+// the isolate behind it is replaced on every reset. A loop over the edges of
+// many vertices thus needs neither a new handle nor a destroy call from
+// python per vertex, and values are transferred in chunks.
+
+typedef struct {
+    void *it;
+} it_pool_t;
+
+int jgrapht_it_pool_create(void** res) {
+    it_pool_t *pool = calloc(1, sizeof(it_pool_t));
+    if (pool == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    *res = pool;
+    return STATUS_SUCCESS;
+}
+
+static int it_pool_release(it_pool_t *pool) {
+    int status = STATUS_SUCCESS;
+    if (pool->it != NULL) {
+        status = jgrapht_handles_destroy(pool->it);
+        pool->it = NULL;
+    }
+    return status;
+}
+
+// Restarts the iterator over the given source of the graph. The vertex is
+// ignored for the vertex and edge sets. After a failed reset the iterator is
+// exhausted.
+int jgrapht_it_pool_reset(void *handle, void *g, int source, int v) {
+    it_pool_t *pool = (it_pool_t *) handle;
+    int status = it_pool_release(pool);
+    if (status != STATUS_SUCCESS) {
+        return status;
+    }
+    switch (source) {
+    case ITERATOR_SOURCE_VERTICES:
+        return jgrapht_graph_create_all_vit(g, &pool->it);
+    case ITERATOR_SOURCE_EDGES:
+        return jgrapht_graph_create_all_eit(g, &pool->it);
+    case ITERATOR_SOURCE_EDGES_OF:
+        return jgrapht_graph_vertex_create_eit(g, v, &pool->it);
+    case ITERATOR_SOURCE_OUT_EDGES_OF:
+        return jgrapht_graph_vertex_create_out_eit(g, v, &pool->it);
+    case ITERATOR_SOURCE_IN_EDGES_OF:
+        return jgrapht_graph_vertex_create_in_eit(g, v, &pool->it);
+    default:
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Unknown iterator source");
+    }
+}
+
+int jgrapht_it_pool_next_int_array(void *handle, int *values, int size, int* res) {
+    it_pool_t *pool = (it_pool_t *) handle;
+    if (pool->it == NULL) {
+        *res = 0;
+        return STATUS_SUCCESS;
+    }
+    return jgrapht_it_next_int_array(pool->it, values, size, res);
+}
+
+int jgrapht_it_pool_destroy(void *handle) {
+    it_pool_t *pool = (it_pool_t *) handle;
+    int status = STATUS_SUCCESS;
+    if (pool != NULL) {
+        status = it_pool_release(pool);
+        free(pool);
+    }
+    return status;
+}
@@ -0,0 +1,355 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Native parallel implementations of scoring algorithms. They work on a csr
+// snapshot of the graph and only call into the isolate in order to build the
+// snapshot and the resulting map.
+
+typedef struct {
+    const jgrapht_csr_t *csr;
+    int *sources;
+    jgrapht_csr_sssp_t **ws;
+    double **delta;
+    double **scores;
+    int reverse;
+    int normalize;
+    double *result;
+} scoring_ctx_t;
+
+static int scoring_ctx_init(scoring_ctx_t *ctx, const jgrapht_csr_t *csr, int threads, int per_worker_scores) {
+    memset(ctx, 0, sizeof(scoring_ctx_t));
+    ctx->csr = csr;
+    ctx->ws = calloc(threads, sizeof(jgrapht_csr_sssp_t *));
+    ctx->delta = calloc(threads, sizeof(double *));
+    ctx->scores = calloc(threads, sizeof(double *));
+    ctx->result = calloc(csr->n > 0 ? csr->n : 1, sizeof(double));
+    if (ctx->ws == NULL || ctx->delta == NULL || ctx->scores == NULL || ctx->result == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+    }
+    for (int i = 0; i < threads; i++) {
+        ctx->ws[i] = jgrapht_csr_sssp_create(csr);
+        if (ctx->ws[i] == NULL) {
+            return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+        }
+        if (per_worker_scores) {
+            ctx->delta[i] = calloc(csr->n > 0 ? csr->n : 1, sizeof(double));
+            ctx->scores[i] = calloc(csr->n > 0 ? csr->n : 1, sizeof(double));
+            if (ctx->delta[i] == NULL || ctx->scores[i] == NULL) {
+                return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+            }
+        }
+    }
+    return STATUS_SUCCESS;
+}
+
+static void scoring_ctx_free(scoring_ctx_t *ctx, int threads) {
+    for (int i = 0; i < threads; i++) {
+        if (ctx->ws != NULL) {
+            jgrapht_csr_sssp_destroy(ctx->ws[i]);
+        }
+        if (ctx->delta != NULL) {
+            free(ctx->delta[i]);
+        }
+        if (ctx->scores != NULL) {
+            free(ctx->scores[i]);
+        }
+    }
+    free(ctx->ws);
+    free(ctx->delta);
+    free(ctx->scores);
+    free(ctx->result);
+    free(ctx->sources);
+}
+
+// brandes dependency accumulation for a single source, see
+// "A faster algorithm for betweenness centrality", U. Brandes, 2001.
+static void brandes_accumulate(const jgrapht_csr_t *csr, jgrapht_csr_sssp_t *ws, double *delta, double *scores, int s) {
+    for (int i = ws->settled - 1; i >= 0; i--) {
+        int w = ws->order[i];
+        double coeff = (1.0 + delta[w]) / ws->sigma[w];
+        for (int a = csr->in_offsets[w]; a < csr->in_offsets[w + 1]; a++) {
+            int v = csr->in_sources[a];
+            double weight = csr->weighted ? csr->in_weights[a] : 1.0;
+            if (ws->dist[v] + weight == ws->dist[w]) {
+                delta[v] += ws->sigma[v] * coeff;
+            }
+        }
+        if (w != s) {
+            scores[w] += delta[w];
+        }
+    }
+    for (int i = 0; i < ws->settled; i++) {
+        delta[ws->order[i]] = 0.0;
+    }
+}
+
+static void betweenness_body(void *arg, int worker, int s) {
+    scoring_ctx_t *ctx = (scoring_ctx_t *) arg;
+    if (ctx->sources != NULL) {
+        s = ctx->sources[s];
+    }
+    jgrapht_csr_sssp_run(ctx->csr, ctx->ws[worker], s, -1, 0);
+    brandes_accumulate(ctx->csr, ctx->ws[worker], ctx->delta[worker], ctx->scores[worker], s);
+}
+
+// When samples is non-negative only that many source vertices, chosen uniformly
+// at random without replacement, are used and the result is scaled by n/samples.
+// See "Centrality estimation in large networks", U. Brandes and C. Pich, 2007.
+static int exec_betweenness(void *g, int normalize, int samples, long long int seed, int threads, void** res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    if (csr->weighted && csr->negative_weights) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative edge weight not allowed");
+    }
+    threads = jgrapht_parallel_threads(threads);
+    scoring_ctx_t ctx;
+    if ((status = scoring_ctx_init(&ctx, csr, threads, 1)) == STATUS_SUCCESS) {
+        int n = csr->n;
+        int count = n;
+        if (samples >= 0 && samples < n) {
+            count = samples;
+            ctx.sources = malloc(sizeof(int) * (n > 0 ? n : 1));
+            if (ctx.sources == NULL) {
+                scoring_ctx_free(&ctx, threads);
+                jgrapht_csr_destroy(csr);
+                return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+            }
+            // partial fisher-yates shuffle
+            unsigned long long state = (unsigned long long) seed;
+            for (int v = 0; v < n; v++) {
+                ctx.sources[v] = v;
+            }
+            for (int i = 0; i < count; i++) {
+                int j = i + jgrapht_random_int(&state, n - i);
+                int tmp = ctx.sources[i];
+                ctx.sources[i] = ctx.sources[j];
+                ctx.sources[j] = tmp;
+            }
+        }
+        jgrapht_parallel_for(count, threads, 1, betweenness_body, &ctx);
+
+        // merge per worker accumulators
+        double factor = csr->directed ? 1.0 : 0.5;
+        if (count != n) {
+            factor *= count > 0 ? (double) n / count : 0.0;
+        }
+        // in double, (n - 1) * (n - 2) overflows an int beyond 46341 vertices
+        double pairs = (double) (n - 1) * (double) (n - 2);
+        if (normalize && pairs != 0.0) {
+            factor /= pairs;
+        }
+        for (int v = 0; v < n; v++) {
+            double sum = 0.0;
+            for (int i = 0; i < threads; i++) {
+                sum += ctx.scores[i][v];
+            }
+            ctx.result[v] = sum * factor;
+        }
+        status = jgrapht_csr_scores_to_map(csr, ctx.result, res);
+    }
+    scoring_ctx_free(&ctx, threads);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
+
+static void closeness_body(void *arg, int worker, int v) {
+    scoring_ctx_t *ctx = (scoring_ctx_t *) arg;
+    jgrapht_csr_sssp_t *ws = ctx->ws[worker];
+    int n = ctx->csr->n;
+    jgrapht_csr_sssp_run(ctx->csr, ws, v, -1, ctx->reverse);
+    double sum = 0.0;
+    for (int u = 0; u < n; u++) {
+        if (u != v) {
+            sum += ws->dist[u];
+        }
+    }
+    ctx->result[v] = ctx->normalize ? (n - 1) / sum : 1 / sum;
+}
+
+static void harmonic_body(void *arg, int worker, int v) {
+    scoring_ctx_t *ctx = (scoring_ctx_t *) arg;
+    jgrapht_csr_sssp_t *ws = ctx->ws[worker];
+    int n = ctx->csr->n;
+    jgrapht_csr_sssp_run(ctx->csr, ws, v, -1, ctx->reverse);
+    double sum = 0.0;
+    for (int u = 0; u < n; u++) {
+        if (u != v) {
+            sum += 1.0 / ws->dist[u];
+        }
+    }
+    ctx->result[v] = ctx->normalize && n > 1 ? sum / (n - 1) : sum;
+}
+
+static int exec_distance_scoring(void *g, int incoming, int normalize, int threads, jgrapht_parallel_body_t body, void** res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    if (csr->negative_weights) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative edge weights not supported in parallel mode");
+    }
+    threads = jgrapht_parallel_threads(threads);
+    scoring_ctx_t ctx;
+    if ((status = scoring_ctx_init(&ctx, csr, threads, 0)) == STATUS_SUCCESS) {
+        ctx.reverse = incoming && csr->directed;
+        ctx.normalize = normalize;
+        jgrapht_parallel_for(csr->n, threads, 1, body, &ctx);
+        status = jgrapht_csr_scores_to_map(csr, ctx.result, res);
+    }
+    scoring_ctx_free(&ctx, threads);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
+
+int jgrapht_scoring_exec_betweenness_centrality_parallel(void *g, int normalize, int threads, void** res) {
+    return exec_betweenness(g, normalize, -1, 0, threads, res);
+}
+
+int jgrapht_scoring_exec_betweenness_centrality_sampled(void *g, int normalize, int samples, long long int seed, int threads, void** res) {
+    if (samples < 0) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Number of samples must be non-negative");
+    }
+    return exec_betweenness(g, normalize, samples, seed, threads, res);
+}
+
+int jgrapht_scoring_exec_closeness_centrality_parallel(void *g, int incoming, int normalize, int threads, void** res) {
+    return exec_distance_scoring(g, incoming, normalize, threads, closeness_body, res);
+}
+
+int jgrapht_scoring_exec_harmonic_centrality_parallel(void *g, int incoming, int normalize, int threads, void** res) {
+    return exec_distance_scoring(g, incoming, normalize, threads, harmonic_body, res);
+}
+
+// pagerank
+
+static int pagerank_vector(const jgrapht_csr_t *csr, int *keys, int keys_size, double *values, int values_size,
+        double missing, double *res) {
+    if (keys_size != values_size) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Keys and values must have the same length");
+    }
+    int n = csr->n;
+    for (int v = 0; v < n; v++) {
+        res[v] = keys != NULL ? missing : 1.0 / n;
+    }
+    for (int i = 0; i < keys_size; i++) {
+        int v = jgrapht_csr_index_of(csr, keys[i]);
+        if (v == -1) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Vertex not contained in the graph");
+        }
+        if (values[i] < 0.0) {
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Scores must be non-negative");
+        }
+        res[v] = values[i];
+    }
+    double sum = 0.0;
+    for (int v = 0; v < n; v++) {
+        sum += res[v];
+    }
+    if (n > 0 && sum <= 0.0) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Scores must not be all zero");
+    }
+    for (int v = 0; v < n; v++) {
+        res[v] /= sum;
+    }
+    return STATUS_SUCCESS;
+}
+
+// Power iteration following the pagerank implementation of the isolate, which
+// distributes the score of dangling vertices to all vertices. Vertices whose
+// out-arcs all have zero weight are dangling as well. The iteration
+// starts from the given initial scores, vertices without an initial score start
+// from 1/n. If a personalization vector is given the random jumps, including
+// those from dangling vertices, land on a vertex proportionally to it.
+int jgrapht_scoring_exec_custom_pagerank_warm_start(void *g, double damping_factor, int max_iterations, double tolerance,
+        int *initial_keys, int initial_keys_size, double *initial_values, int initial_values_size,
+        int *personalization_keys, int personalization_keys_size, double *personalization_values, int personalization_values_size,
+        void** res) {
+    if (damping_factor < 0.0 || damping_factor > 1.0) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Damping factor not valid");
+    }
+    if (max_iterations <= 0) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Maximum iterations must be positive");
+    }
+    if (tolerance <= 0.0) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Tolerance not valid, must be positive");
+    }
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = csr->n;
+    int size = n > 0 ? n : 1;
+    double *cur = malloc(sizeof(double) * size);
+    double *next = malloc(sizeof(double) * size);
+    double *out_weight = calloc(size, sizeof(double));
+    double *jump = personalization_keys != NULL ? malloc(sizeof(double) * size) : NULL;
+    if (cur == NULL || next == NULL || out_weight == NULL || (personalization_keys != NULL && jump == NULL)) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+        goto cleanup;
+    }
+    if ((status = pagerank_vector(csr, initial_keys, initial_keys_size, initial_values, initial_values_size,
+            1.0 / n, cur)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+    if (jump != NULL && (status = pagerank_vector(csr, personalization_keys, personalization_keys_size,
+            personalization_values, personalization_values_size, 0.0, jump)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+    for (int v = 0; v < n; v++) {
+        for (int a = csr->out_offsets[v]; a < csr->out_offsets[v + 1]; a++) {
+            out_weight[v] += csr->weighted ? csr->out_weights[a] : 1.0;
+        }
+    }
+
+    double max_change = tolerance;
+    while (max_iterations > 0 && max_change >= tolerance) {
+        // mass which is redistributed by random jumps
+        double r = 0.0;
+        for (int v = 0; v < n; v++) {
+            r += out_weight[v] != 0.0 ? (1.0 - damping_factor) * cur[v] : cur[v];
+        }
+        max_change = 0.0;
+        for (int v = 0; v < n; v++) {
+            double contribution = 0.0;
+            for (int a = csr->in_offsets[v]; a < csr->in_offsets[v + 1]; a++) {
+                int u = csr->in_sources[a];
+                if (out_weight[u] == 0.0) {
+                    // dangling, its score is redistributed by random jumps
+                    continue;
+                }
+                double weight = csr->weighted ? csr->in_weights[a] : 1.0;
+                contribution += damping_factor * cur[u] * weight / out_weight[u];
+            }
+            double value = (jump != NULL ? r * jump[v] : r / n) + contribution;
+            double change = fabs(value - cur[v]);
+            if (change > max_change) {
+                max_change = change;
+            }
+            next[v] = value;
+        }
+        double *tmp = cur;
+        cur = next;
+        next = tmp;
+        max_iterations--;
+    }
+    status = jgrapht_csr_scores_to_map(csr, cur, res);
+
+cleanup:
+    free(cur);
+    free(next);
+    free(out_weight);
+    free(jump);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
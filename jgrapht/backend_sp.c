@@ -0,0 +1,742 @@
+#include <stdlib.h>
+#include <limits.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Native shortest path queries on a csr snapshot of the graph.
+
+// Edges of one or more paths, owned by the native code. The caller learns
+// the number of edges from the query and copies them into its own buffer.
+typedef struct {
+    int size;
+    int *edges;
+} sp_paths_t;
+
+static sp_paths_t *sp_paths_create(int size) {
+    sp_paths_t *paths = malloc(sizeof(sp_paths_t));
+    if (paths == NULL) {
+        return NULL;
+    }
+    paths->size = size;
+    paths->edges = malloc(sizeof(int) * (size > 0 ? size : 1));
+    if (paths->edges == NULL) {
+        free(paths);
+        return NULL;
+    }
+    return paths;
+}
+
+int jgrapht_sp_paths_destroy(void *handle) {
+    sp_paths_t *paths = (sp_paths_t *) handle;
+    if (paths != NULL) {
+        free(paths->edges);
+        free(paths);
+    }
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_sp_paths_copy(void *handle, int *edges, int edges_size) {
+    sp_paths_t *paths = (sp_paths_t *) handle;
+    if (edges_size < paths->size) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result array smaller than the number of edges");
+    }
+    memcpy(edges, paths->edges, sizeof(int) * paths->size);
+    return STATUS_SUCCESS;
+}
+
+typedef struct {
+    const jgrapht_csr_t *csr;
+    jgrapht_csr_sssp_t **ws;
+    int *targets;
+    int *groups;
+    int *group_offsets;
+    int *group_queries;
+    double *distances;
+    int **paths;
+    int *path_lengths;
+    int failed;
+} sp_batch_ctx_t;
+
+static void sp_batch_body(void *arg, int worker, int item) {
+    sp_batch_ctx_t *ctx = (sp_batch_ctx_t *) arg;
+    jgrapht_csr_sssp_t *ws = ctx->ws[worker];
+    int s = ctx->groups[item];
+    int begin = ctx->group_offsets[s];
+    int end = ctx->group_offsets[s + 1];
+
+    // a single target allows the search to stop early
+    int target = end - begin == 1 ? ctx->targets[ctx->group_queries[begin]] : -1;
+    jgrapht_csr_sssp_run(ctx->csr, ws, s, target, 0);
+
+    for (int i = begin; i < end; i++) {
+        int q = ctx->group_queries[i];
+        int t = ctx->targets[q];
+        ctx->distances[q] = ws->dist[t];
+        if (ctx->paths != NULL) {
+            int length = jgrapht_csr_sssp_path(ctx->csr, ws, t, 0, NULL);
+            ctx->paths[q] = malloc(sizeof(int) * (length > 0 ? length : 1));
+            if (ctx->paths[q] == NULL) {
+                __atomic_store_n(&ctx->failed, 1, __ATOMIC_RELAXED);
+                continue;
+            }
+            ctx->path_lengths[q] = jgrapht_csr_sssp_path(ctx->csr, ws, t, 0, ctx->paths[q]);
+        }
+    }
+}
+
+// Computes the shortest path distance for each (sources[i], targets[i]) pair
+// on a snapshot without negative weights. Queries with the same source share
+// a single search. If offsets is not NULL the edges of all paths are returned
+// as native paths where the edges of path i are at positions offsets[i] to
+// offsets[i+1].
+static int sp_batch_exec(const jgrapht_csr_t *csr, int *sources, int sources_size,
+        int *targets, int targets_size, int threads, double *distances, int distances_size,
+        int *offsets, int offsets_size, void** edges_res) {
+    if (sources_size != targets_size) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Sources and targets must have the same length");
+    }
+    int k = sources_size;
+    if (distances_size < k || (offsets != NULL && offsets_size < k + 1)) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result arrays smaller than the number of queries");
+    }
+
+    int status = STATUS_SUCCESS;
+    int n = csr->n;
+    threads = jgrapht_parallel_threads(threads);
+    sp_batch_ctx_t ctx;
+    memset(&ctx, 0, sizeof(sp_batch_ctx_t));
+    ctx.csr = csr;
+    ctx.distances = distances;
+    int *query_sources = malloc(sizeof(int) * (k > 0 ? k : 1));
+    ctx.targets = malloc(sizeof(int) * (k > 0 ? k : 1));
+    ctx.groups = malloc(sizeof(int) * (n > 0 ? n : 1));
+    ctx.group_offsets = calloc(n + 1, sizeof(int));
+    ctx.group_queries = malloc(sizeof(int) * (k > 0 ? k : 1));
+    ctx.ws = calloc(threads, sizeof(jgrapht_csr_sssp_t *));
+    if (offsets != NULL) {
+        ctx.paths = calloc(k > 0 ? k : 1, sizeof(int *));
+        ctx.path_lengths = calloc(k > 0 ? k : 1, sizeof(int));
+    }
+    if (query_sources == NULL || ctx.targets == NULL || ctx.groups == NULL || ctx.group_offsets == NULL
+            || ctx.group_queries == NULL || ctx.ws == NULL
+            || (offsets != NULL && (ctx.paths == NULL || ctx.path_lengths == NULL))) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+        goto cleanup;
+    }
+    if ((status = jgrapht_csr_indices_of(csr, sources, k, query_sources)) != STATUS_SUCCESS
+            || (status = jgrapht_csr_indices_of(csr, targets, k, ctx.targets)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+    for (int i = 0; i < threads; i++) {
+        if ((ctx.ws[i] = jgrapht_csr_sssp_create(csr)) == NULL) {
+            status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+            goto cleanup;
+        }
+    }
+
+    // bucket the queries by source, keeping their relative order
+    for (int q = 0; q < k; q++) {
+        ctx.group_offsets[query_sources[q] + 1]++;
+    }
+    int ngroups = 0;
+    for (int v = 0; v < n; v++) {
+        if (ctx.group_offsets[v + 1] > 0) {
+            ctx.groups[ngroups++] = v;
+        }
+        ctx.group_offsets[v + 1] += ctx.group_offsets[v];
+    }
+    for (int q = 0; q < k; q++) {
+        ctx.group_queries[ctx.group_offsets[query_sources[q]]++] = q;
+    }
+    // every bucket begin has moved to the begin of the next bucket
+    for (int v = n; v > 0; v--) {
+        ctx.group_offsets[v] = ctx.group_offsets[v - 1];
+    }
+    ctx.group_offsets[0] = 0;
+
+    jgrapht_parallel_for(ngroups, threads, 1, sp_batch_body, &ctx);
+
+    if (ctx.failed) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate paths");
+        goto cleanup;
+    }
+
+    if (offsets != NULL) {
+        long long total = 0;
+        offsets[0] = 0;
+        for (int q = 0; q < k; q++) {
+            total += ctx.path_lengths[q];
+            if (total > INT_MAX) {
+                status = jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Total length of the paths exceeds the array size limit");
+                goto cleanup;
+            }
+            offsets[q + 1] = (int) total;
+        }
+        sp_paths_t *paths = sp_paths_create((int) total);
+        if (paths == NULL) {
+            status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate paths");
+            goto cleanup;
+        }
+        for (int q = 0; q < k; q++) {
+            memcpy(paths->edges + offsets[q], ctx.paths[q], sizeof(int) * ctx.path_lengths[q]);
+        }
+        *edges_res = paths;
+    } else if (edges_res != NULL) {
+        *edges_res = NULL;
+    }
+
+cleanup:
+    if (ctx.ws != NULL) {
+        for (int i = 0; i < threads; i++) {
+            jgrapht_csr_sssp_destroy(ctx.ws[i]);
+        }
+    }
+    if (ctx.paths != NULL) {
+        for (int q = 0; q < k; q++) {
+            free(ctx.paths[q]);
+        }
+    }
+    free(ctx.ws);
+    free(ctx.paths);
+    free(ctx.path_lengths);
+    free(query_sources);
+    free(ctx.targets);
+    free(ctx.groups);
+    free(ctx.group_offsets);
+    free(ctx.group_queries);
+    return status;
+}
+
+// The batch on a new snapshot of the graph. Taking the snapshot costs O(n+m)
+// and a call into the isolate per vertex and edge, which dominates small
+// batches. Repeated batches on the same graph should use the snapshot of an
+// index with jgrapht_sp_index_dijkstra_get_paths_between_vertex_pairs.
+int jgrapht_sp_exec_dijkstra_get_paths_between_vertex_pairs(void *g, int *sources, int sources_size,
+        int *targets, int targets_size, int threads, double *distances, int distances_size,
+        int *offsets, int offsets_size, void** edges_res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    if (csr->negative_weights) {
+        status = jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative edge weights not allowed");
+    } else {
+        status = sp_batch_exec(csr, sources, sources_size, targets, targets_size, threads,
+            distances, distances_size, offsets, offsets_size, edges_res);
+    }
+    jgrapht_csr_destroy(csr);
+    return status;
+}
+
+// shortest path index using A* with landmark (ALT) lower bounds, see
+// "Computing the shortest path: A* search meets graph theory",
+// A. V. Goldberg and C. Harrelson, 2005.
+
+typedef struct {
+    jgrapht_csr_t *csr;
+    int landmarks;
+    double *from;
+    double *to;
+    pthread_mutex_t lock;
+    jgrapht_csr_sssp_t *ws;
+} sp_index_t;
+
+static double alt_heuristic(void *arg, int v, int t) {
+    sp_index_t *index = (sp_index_t *) arg;
+    int n = index->csr->n;
+    double h = 0.0;
+    for (int l = 0; l < index->landmarks; l++) {
+        // d(L,t) <= d(L,v) + d(v,t) and d(v,L) <= d(v,t) + d(t,L)
+        double lt = index->from[(size_t) l * n + t];
+        double lv = index->from[(size_t) l * n + v];
+        if (lt != INFINITY && lv != INFINITY && lt - lv > h) {
+            h = lt - lv;
+        }
+        double vl = index->to[(size_t) l * n + v];
+        double tl = index->to[(size_t) l * n + t];
+        if (vl != INFINITY && tl != INFINITY && vl - tl > h) {
+            h = vl - tl;
+        }
+    }
+    return h;
+}
+
+int jgrapht_sp_index_destroy(void *handle) {
+    sp_index_t *index = (sp_index_t *) handle;
+    if (index == NULL) {
+        return STATUS_SUCCESS;
+    }
+    pthread_mutex_destroy(&index->lock);
+    jgrapht_csr_sssp_destroy(index->ws);
+    if (index->to != index->from) {
+        free(index->to);
+    }
+    free(index->from);
+    jgrapht_csr_destroy(index->csr);
+    free(index);
+    return STATUS_SUCCESS;
+}
+
+// Landmarks are selected greedily, each one is the vertex farthest away from
+// the already selected landmarks. Unreachable vertices count as farthest.
+int jgrapht_sp_index_alt_create(void *g, int landmarks, void** res) {
+    if (landmarks <= 0) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Number of landmarks must be positive");
+    }
+    sp_index_t *index = calloc(1, sizeof(sp_index_t));
+    if (index == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate index");
+    }
+    pthread_mutex_init(&index->lock, NULL);
+    int status;
+    if ((status = jgrapht_csr_create(g, &index->csr)) != STATUS_SUCCESS) {
+        jgrapht_sp_index_destroy(index);
+        return status;
+    }
+    jgrapht_csr_t *csr = index->csr;
+    if (csr->negative_weights) {
+        jgrapht_sp_index_destroy(index);
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative edge weights not allowed");
+    }
+    int n = csr->n;
+    if (landmarks > n) {
+        landmarks = n;
+    }
+    index->landmarks = landmarks;
+    index->ws = jgrapht_csr_sssp_create(csr);
+    index->from = malloc(sizeof(double) * ((size_t) landmarks * n + 1));
+    index->to = csr->directed ? malloc(sizeof(double) * ((size_t) landmarks * n + 1)) : index->from;
+    double *closest = malloc(sizeof(double) * (n > 0 ? n : 1));
+    if (index->ws == NULL || index->from == NULL || index->to == NULL || closest == NULL) {
+        free(closest);
+        jgrapht_sp_index_destroy(index);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate index");
+    }
+
+    jgrapht_csr_sssp_t *ws = index->ws;
+    int landmark = 0;
+    if (n > 0) {
+        // start from the vertex farthest away from an arbitrary vertex
+        jgrapht_csr_sssp_run(csr, ws, 0, -1, 0);
+        landmark = ws->order[ws->settled - 1];
+    }
+    for (int v = 0; v < n; v++) {
+        closest[v] = INFINITY;
+    }
+    for (int l = 0; l < landmarks; l++) {
+        double *from = index->from + (size_t) l * n;
+        jgrapht_csr_sssp_run(csr, ws, landmark, -1, 0);
+        memcpy(from, ws->dist, sizeof(double) * n);
+        if (csr->directed) {
+            jgrapht_csr_sssp_run(csr, ws, landmark, -1, 1);
+            memcpy(index->to + (size_t) l * n, ws->dist, sizeof(double) * n);
+        }
+        closest[landmark] = -1.0;
+        int next = landmark;
+        for (int v = 0; v < n; v++) {
+            if (from[v] < closest[v]) {
+                closest[v] = from[v];
+            }
+            if (closest[v] > closest[next]) {
+                next = v;
+            }
+        }
+        landmark = next;
+    }
+    free(closest);
+    *res = index;
+    return STATUS_SUCCESS;
+}
+
+static int sp_index_positions(sp_index_t *index, int source, int target, int *s, int *t) {
+    if ((*s = jgrapht_csr_index_of(index->csr, source)) == -1 || (*t = jgrapht_csr_index_of(index->csr, target)) == -1) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Vertex not contained in the graph");
+    }
+    return STATUS_SUCCESS;
+}
+
+// Runs a single query from the calling thread. The cached workspace of the
+// index is used unless another thread is currently using it.
+static int sp_index_query(sp_index_t *index, int source, int target, double *distance, int *length, void** edges_res) {
+    int s, t, status;
+    if ((status = sp_index_positions(index, source, target, &s, &t)) != STATUS_SUCCESS) {
+        return status;
+    }
+    int locked = pthread_mutex_trylock(&index->lock) == 0;
+    jgrapht_csr_sssp_t *ws = locked ? index->ws : jgrapht_csr_sssp_create(index->csr);
+    if (ws == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+    }
+    jgrapht_csr_sssp_run_astar(index->csr, ws, s, t, alt_heuristic, index);
+    if (ws->failed) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+    } else {
+        *distance = ws->dist[t];
+    }
+    if (status == STATUS_SUCCESS && edges_res != NULL) {
+        sp_paths_t *paths = sp_paths_create(jgrapht_csr_sssp_path(index->csr, ws, t, 0, NULL));
+        if (paths == NULL) {
+            status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate paths");
+        } else {
+            jgrapht_csr_sssp_path(index->csr, ws, t, 0, paths->edges);
+            *length = paths->size;
+            *edges_res = paths;
+        }
+    }
+    if (locked) {
+        pthread_mutex_unlock(&index->lock);
+    } else {
+        jgrapht_csr_sssp_destroy(ws);
+    }
+    return status;
+}
+
+int jgrapht_sp_index_query_distance(void *handle, int source, int target, double* res) {
+    return sp_index_query((sp_index_t *) handle, source, target, res, NULL, NULL);
+}
+
+int jgrapht_sp_index_query_path(void *handle, int source, int target, double* distance_res, int* length_res, void** edges_res) {
+    return sp_index_query((sp_index_t *) handle, source, target, distance_res, length_res, edges_res);
+}
+
+typedef struct {
+    sp_index_t *index;
+    jgrapht_csr_sssp_t **ws;
+    int *sources;
+    int *targets;
+    double *distances;
+    int failed;
+} sp_index_batch_ctx_t;
+
+static void sp_index_batch_body(void *arg, int worker, int q) {
+    sp_index_batch_ctx_t *ctx = (sp_index_batch_ctx_t *) arg;
+    jgrapht_csr_sssp_t *ws = ctx->ws[worker];
+    jgrapht_csr_sssp_run_astar(ctx->index->csr, ws, ctx->sources[q], ctx->targets[q], alt_heuristic, ctx->index);
+    if (ws->failed) {
+        __atomic_store_n(&ctx->failed, 1, __ATOMIC_RELAXED);
+    }
+    ctx->distances[q] = ws->dist[ctx->targets[q]];
+}
+
+int jgrapht_sp_index_query_distances(void *handle, int *sources, int sources_size, int *targets, int targets_size,
+        int threads, double *distances, int distances_size) {
+    sp_index_t *index = (sp_index_t *) handle;
+    if (sources_size != targets_size) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Sources and targets must have the same length");
+    }
+    int k = sources_size;
+    if (distances_size < k) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Result array smaller than the number of queries");
+    }
+    threads = jgrapht_parallel_threads(threads);
+    if (threads > k) {
+        threads = k > 0 ? k : 1;
+    }
+    sp_index_batch_ctx_t ctx;
+    memset(&ctx, 0, sizeof(sp_index_batch_ctx_t));
+    ctx.index = index;
+    ctx.distances = distances;
+    ctx.sources = malloc(sizeof(int) * (k > 0 ? k : 1));
+    ctx.targets = malloc(sizeof(int) * (k > 0 ? k : 1));
+    ctx.ws = calloc(threads, sizeof(jgrapht_csr_sssp_t *));
+    int status = STATUS_SUCCESS;
+    if (ctx.sources == NULL || ctx.targets == NULL || ctx.ws == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+        goto cleanup;
+    }
+    if ((status = jgrapht_csr_indices_of(index->csr, sources, k, ctx.sources)) != STATUS_SUCCESS
+            || (status = jgrapht_csr_indices_of(index->csr, targets, k, ctx.targets)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+    for (int i = 0; i < threads; i++) {
+        if ((ctx.ws[i] = jgrapht_csr_sssp_create(index->csr)) == NULL) {
+            status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+            goto cleanup;
+        }
+    }
+    jgrapht_parallel_for(k, threads, 16, sp_index_batch_body, &ctx);
+    if (ctx.failed) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+    }
+
+cleanup:
+    if (ctx.ws != NULL) {
+        for (int i = 0; i < threads; i++) {
+            jgrapht_csr_sssp_destroy(ctx.ws[i]);
+        }
+    }
+    free(ctx.ws);
+    free(ctx.sources);
+    free(ctx.targets);
+    return status;
+}
+
+// The batch of jgrapht_sp_exec_dijkstra_get_paths_between_vertex_pairs on the
+// snapshot of an index, which is only read, thus batches may run concurrently.
+int jgrapht_sp_index_dijkstra_get_paths_between_vertex_pairs(void *handle, int *sources, int sources_size,
+        int *targets, int targets_size, int threads, double *distances, int distances_size,
+        int *offsets, int offsets_size, void** edges_res) {
+    sp_index_t *index = (sp_index_t *) handle;
+    return sp_batch_exec(index->csr, sources, sources_size, targets, targets_size, threads,
+        distances, distances_size, offsets, offsets_size, edges_res);
+}
+
+// all pairs distances
+
+typedef struct {
+    const jgrapht_csr_t *csr;
+    jgrapht_csr_sssp_t **ws;
+    int *positions;
+    int count;
+    double *matrix;
+} sp_matrix_ctx_t;
+
+static void sp_matrix_body(void *arg, int worker, int i) {
+    sp_matrix_ctx_t *ctx = (sp_matrix_ctx_t *) arg;
+    jgrapht_csr_sssp_t *ws = ctx->ws[worker];
+    jgrapht_csr_sssp_run(ctx->csr, ws, ctx->positions[i], -1, 0);
+    double *row = ctx->matrix + (size_t) i * ctx->count;
+    for (int j = 0; j < ctx->count; j++) {
+        row[j] = ws->dist[ctx->positions[j]];
+    }
+}
+
+// Writes the distances between all pairs of the given vertices into matrix in
+// row-major order, entry (i, j) is the distance from vertices[i] to vertices[j].
+// Paths may pass through any vertex of the graph.
+int jgrapht_sp_exec_allpairs_distance_matrix(void *g, int *vertices, int vertices_size, int threads,
+        double *matrix, int matrix_size) {
+    int k = vertices_size;
+    if ((long long int) matrix_size < (long long int) k * k) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Matrix smaller than the number of vertices squared");
+    }
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    if (csr->negative_weights) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative edge weights not allowed");
+    }
+    threads = jgrapht_parallel_threads(threads);
+    if (threads > k) {
+        threads = k > 0 ? k : 1;
+    }
+    sp_matrix_ctx_t ctx;
+    memset(&ctx, 0, sizeof(sp_matrix_ctx_t));
+    ctx.csr = csr;
+    ctx.count = k;
+    ctx.matrix = matrix;
+    ctx.positions = malloc(sizeof(int) * (k > 0 ? k : 1));
+    ctx.ws = calloc(threads, sizeof(jgrapht_csr_sssp_t *));
+    if (ctx.positions == NULL || ctx.ws == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+        goto cleanup;
+    }
+    if ((status = jgrapht_csr_indices_of(csr, vertices, k, ctx.positions)) != STATUS_SUCCESS) {
+        goto cleanup;
+    }
+    for (int i = 0; i < threads; i++) {
+        if ((ctx.ws[i] = jgrapht_csr_sssp_create(csr)) == NULL) {
+            status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+            goto cleanup;
+        }
+    }
+    jgrapht_parallel_for(k, threads, 1, sp_matrix_body, &ctx);
+
+cleanup:
+    if (ctx.ws != NULL) {
+        for (int i = 0; i < threads; i++) {
+            jgrapht_csr_sssp_destroy(ctx.ws[i]);
+        }
+    }
+    free(ctx.ws);
+    free(ctx.positions);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
+
+// multi-source breadth first search, direction optimizing as in
+// "Direction-optimizing breadth-first search", S. Beamer, K. Asanovic and
+// D. Patterson, 2012. Levels are expanded top-down from the frontier while it
+// is small and bottom-up, from the unvisited vertices, once the arcs leaving
+// the frontier outnumber a fraction of the unexplored arcs.
+
+#define BFS_ALPHA 14
+#define BFS_BETA 24
+#define BFS_PARALLEL_ITEMS 4096
+
+typedef struct {
+    int *next;
+    int size;
+    int capacity;
+    long long arcs;
+    int failed;
+} bfs_worker_t;
+
+typedef struct {
+    const jgrapht_csr_t *csr;
+    int *depth;
+    int *parent;
+    int *frontier;
+    int level;
+    bfs_worker_t *workers;
+} bfs_ctx_t;
+
+static void bfs_visit(bfs_ctx_t *ctx, bfs_worker_t *w, int v, int u) {
+    const jgrapht_csr_t *csr = ctx->csr;
+    if (ctx->parent != NULL) {
+        ctx->parent[v] = csr->vertices[u];
+    }
+    if (w->size == w->capacity) {
+        int capacity = w->capacity > 0 ? 2 * w->capacity : 1024;
+        int *next = realloc(w->next, sizeof(int) * capacity);
+        if (next == NULL) {
+            w->failed = 1;
+            return;
+        }
+        w->next = next;
+        w->capacity = capacity;
+    }
+    w->next[w->size++] = v;
+    w->arcs += csr->out_offsets[v + 1] - csr->out_offsets[v];
+}
+
+static void bfs_top_down_body(void *arg, int worker, int item) {
+    bfs_ctx_t *ctx = (bfs_ctx_t *) arg;
+    const jgrapht_csr_t *csr = ctx->csr;
+    int u = ctx->frontier[item];
+    for (int k = csr->out_offsets[u]; k < csr->out_offsets[u + 1]; k++) {
+        int v = csr->out_targets[k];
+        int unvisited = -1;
+        if (__atomic_load_n(&ctx->depth[v], __ATOMIC_RELAXED) == -1
+                && __atomic_compare_exchange_n(&ctx->depth[v], &unvisited, ctx->level + 1, 0,
+                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            bfs_visit(ctx, ctx->workers + worker, v, u);
+        }
+    }
+}
+
+static void bfs_bottom_up_body(void *arg, int worker, int v) {
+    bfs_ctx_t *ctx = (bfs_ctx_t *) arg;
+    const jgrapht_csr_t *csr = ctx->csr;
+    if (ctx->depth[v] != -1) {
+        return;
+    }
+    // only the owner of v writes its depth, others read the previous level
+    for (int k = csr->in_offsets[v]; k < csr->in_offsets[v + 1]; k++) {
+        int u = csr->in_sources[k];
+        if (__atomic_load_n(&ctx->depth[u], __ATOMIC_RELAXED) == ctx->level) {
+            __atomic_store_n(&ctx->depth[v], ctx->level + 1, __ATOMIC_RELAXED);
+            bfs_visit(ctx, ctx->workers + worker, v, u);
+            return;
+        }
+    }
+}
+
+// Writes the number of hops from the closest source into depth and the
+// previous vertex of a shortest path into parent, both indexed by the position
+// of the vertex in the vertex set of the graph. Sources have parent -1 and
+// vertices farther away than max_depth, or unreachable, have depth -1. A
+// negative max_depth means no limit. Parent may be NULL. Since -1 may also
+// be a vertex, parent is only defined where depth is positive.
+int jgrapht_sp_exec_bfs_multisource(void *g, int *sources, int sources_size, int max_depth, int threads,
+        int *depth, int depth_size, int *parent, int parent_size) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = csr->n;
+    if (depth_size < n || (parent != NULL && parent_size < n)) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Arrays smaller than the number of vertices");
+    }
+    threads = jgrapht_parallel_threads(threads);
+    bfs_ctx_t ctx;
+    memset(&ctx, 0, sizeof(bfs_ctx_t));
+    ctx.csr = csr;
+    ctx.depth = depth;
+    ctx.parent = parent;
+    ctx.frontier = malloc(sizeof(int) * (n > 0 ? n : 1));
+    ctx.workers = calloc(threads, sizeof(bfs_worker_t));
+    if (ctx.frontier == NULL || ctx.workers == NULL) {
+        status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+        goto cleanup;
+    }
+    for (int v = 0; v < n; v++) {
+        depth[v] = -1;
+        if (parent != NULL) {
+            parent[v] = -1;
+        }
+    }
+    int frontier_size = 0;
+    long long frontier_arcs = 0;
+    long long unexplored_arcs = csr->out_offsets[n];
+    for (int i = 0; i < sources_size; i++) {
+        int s = jgrapht_csr_index_of(csr, sources[i]);
+        if (s == -1) {
+            status = jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Vertex not contained in the graph");
+            goto cleanup;
+        }
+        if (depth[s] == -1) {
+            depth[s] = 0;
+            ctx.frontier[frontier_size++] = s;
+            frontier_arcs += csr->out_offsets[s + 1] - csr->out_offsets[s];
+        }
+    }
+    unexplored_arcs -= frontier_arcs;
+
+    int bottom_up = 0;
+    while (frontier_size > 0 && (max_depth < 0 || ctx.level < max_depth)) {
+        if (!bottom_up && frontier_arcs > unexplored_arcs / BFS_ALPHA) {
+            bottom_up = 1;
+        } else if (bottom_up && frontier_size < n / BFS_BETA) {
+            bottom_up = 0;
+        }
+        int items = bottom_up ? n : frontier_size;
+        int level_threads = items < BFS_PARALLEL_ITEMS ? 1 : threads;
+        if (bottom_up) {
+            jgrapht_parallel_for(n, level_threads, 1024, bfs_bottom_up_body, &ctx);
+        } else {
+            jgrapht_parallel_for(frontier_size, level_threads, 64, bfs_top_down_body, &ctx);
+        }
+
+        // the next frontier replaces the current one
+        frontier_size = 0;
+        frontier_arcs = 0;
+        for (int i = 0; i < threads; i++) {
+            bfs_worker_t *w = ctx.workers + i;
+            if (w->failed) {
+                status = jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate workspace");
+                goto cleanup;
+            }
+            if (w->size > 0) {
+                memcpy(ctx.frontier + frontier_size, w->next, sizeof(int) * w->size);
+                frontier_size += w->size;
+            }
+            frontier_arcs += w->arcs;
+            w->size = 0;
+            w->arcs = 0;
+        }
+        unexplored_arcs -= frontier_arcs;
+        ctx.level++;
+    }
+
+cleanup:
+    if (ctx.workers != NULL) {
+        for (int i = 0; i < threads; i++) {
+            free(ctx.workers[i].next);
+        }
+    }
+    free(ctx.workers);
+    free(ctx.frontier);
+    jgrapht_csr_destroy(csr);
+    return status;
+}
@@ -0,0 +1,88 @@
+#include <stdlib.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Minimum spanning forests computed on a csr snapshot of the graph, thus also
+// on the weights of weighted views.
+
+typedef struct {
+    double weight;
+    int u;
+    int v;
+    int edge;
+} mst_edge_t;
+
+static int compare_mst_edge(const void *a, const void *b) {
+    const mst_edge_t *x = (const mst_edge_t *) a, *y = (const mst_edge_t *) b;
+    if (x->weight != y->weight) {
+        return (x->weight > y->weight) - (x->weight < y->weight);
+    }
+    return (x->edge > y->edge) - (x->edge < y->edge);
+}
+
+// union-find root with path halving
+static int mst_find(int *parent, int v) {
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];
+        v = parent[v];
+    }
+    return v;
+}
+
+// Kruskal's algorithm. The edges of the forest are written into edges, res is
+// their number.
+int jgrapht_mst_exec_kruskal_edges(void *g, double* weight_res, int *edges, int edges_size, int* res) {
+    jgrapht_csr_t *csr;
+    int status;
+    if ((status = jgrapht_csr_create(g, &csr)) != STATUS_SUCCESS) {
+        return status;
+    }
+    int n = csr->n, m = csr->m;
+    if (edges_size < (n > 0 ? n - 1 : 0)) {
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Array smaller than the number of vertices minus one");
+    }
+    mst_edge_t *sorted = malloc(sizeof(mst_edge_t) * (m > 0 ? m : 1));
+    int *parent = malloc(sizeof(int) * (n > 0 ? n : 1));
+    if (sorted == NULL || parent == NULL) {
+        free(sorted);
+        free(parent);
+        jgrapht_csr_destroy(csr);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    int count = 0;
+    for (int u = 0; u < n; u++) {
+        parent[u] = u;
+        for (int k = csr->out_offsets[u]; k < csr->out_offsets[u + 1]; k++) {
+            int v = csr->out_targets[k];
+            // undirected edges are seen from both endpoints, self-loops never
+            // join two trees
+            if (v == u || (!csr->directed && v < u)) {
+                continue;
+            }
+            mst_edge_t *e = &sorted[count++];
+            e->weight = csr->out_weights[k];
+            e->u = u;
+            e->v = v;
+            e->edge = csr->out_edges[k];
+        }
+    }
+    qsort(sorted, count, sizeof(mst_edge_t), compare_mst_edge);
+    double weight = 0.0;
+    int size = 0;
+    for (int i = 0; i < count && size < n - 1; i++) {
+        int ru = mst_find(parent, sorted[i].u), rv = mst_find(parent, sorted[i].v);
+        if (ru != rv) {
+            parent[ru] = rv;
+            weight += sorted[i].weight;
+            edges[size++] = sorted[i].edge;
+        }
+    }
+    free(sorted);
+    free(parent);
+    jgrapht_csr_destroy(csr);
+    *weight_res = weight;
+    *res = size;
+    return STATUS_SUCCESS;
+}
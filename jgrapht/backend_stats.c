@@ -0,0 +1,180 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Instrumentation of the entry points called from Python. The SWIG wrapper of
+// every backend function brackets the call with jgrapht_stats_call_begin and
+// jgrapht_stats_call_end. While stats are disabled this amounts to reading a
+// flag. Otherwise a call costs two clock reads and four relaxed atomic
+// additions on the counters of its entry point, which are registered on the
+// first call and never freed since the wrappers keep pointers to them.
+//
+// Handles returned to Python and handles destroyed from Python are always
+// counted, thus the number of live handles is valid no matter when stats
+// are enabled.
+
+struct jgrapht_stats_entry {
+    const char *name;
+    long long calls;
+    long long errors;
+    long long nanos;
+    long long bytes;
+    struct jgrapht_stats_entry *next;
+};
+
+static int enabled = 0;
+
+static pthread_mutex_t entries_lock = PTHREAD_MUTEX_INITIALIZER;
+static jgrapht_stats_entry_t *entries_head = NULL;
+static jgrapht_stats_entry_t *entries_tail = NULL;
+static int entries_count = 0;
+
+static long long handles_created = 0;
+static long long handles_destroyed = 0;
+
+// bytes of the array arguments converted for the next call on this thread
+static __thread long long pending_bytes = 0;
+
+static long long now_nanos() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    long long t = (long long) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+    // zero means that the call is not measured
+    return t != 0 ? t : 1;
+}
+
+static jgrapht_stats_entry_t *entry_register(jgrapht_stats_entry_t **slot, const char *name) {
+    pthread_mutex_lock(&entries_lock);
+    jgrapht_stats_entry_t *e = *slot;
+    if (e == NULL) {
+        for (e = entries_head; e != NULL && strcmp(e->name, name) != 0; e = e->next)
+            ;
+    }
+    if (e == NULL && (e = calloc(1, sizeof(jgrapht_stats_entry_t))) != NULL) {
+        e->name = name;
+        if (entries_tail == NULL) {
+            entries_head = e;
+        } else {
+            entries_tail->next = e;
+        }
+        entries_tail = e;
+        entries_count++;
+    }
+    if (e != NULL) {
+        __atomic_store_n(slot, e, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&entries_lock);
+    return e;
+}
+
+long long jgrapht_stats_call_begin(long long *bytes) {
+    if (!__atomic_load_n(&enabled, __ATOMIC_RELAXED)) {
+        return 0;
+    }
+    *bytes = pending_bytes;
+    pending_bytes = 0;
+    return now_nanos();
+}
+
+void jgrapht_stats_call_end(jgrapht_stats_entry_t **slot, const char *name, long long start, long long bytes, int status) {
+    if (start == 0) {
+        return;
+    }
+    long long elapsed = now_nanos() - start;
+    jgrapht_stats_entry_t *e = __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+    if (e == NULL && (e = entry_register(slot, name)) == NULL) {
+        return;
+    }
+    __atomic_add_fetch(&e->calls, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&e->nanos, elapsed, __ATOMIC_RELAXED);
+    if (bytes != 0) {
+        __atomic_add_fetch(&e->bytes, bytes, __ATOMIC_RELAXED);
+    }
+    if (status != STATUS_SUCCESS) {
+        __atomic_add_fetch(&e->errors, 1, __ATOMIC_RELAXED);
+    }
+}
+
+void jgrapht_stats_add_bytes(long long bytes) {
+    if (__atomic_load_n(&enabled, __ATOMIC_RELAXED)) {
+        pending_bytes += bytes;
+    }
+}
+
+void jgrapht_stats_clear_bytes() {
+    pending_bytes = 0;
+}
+
+void jgrapht_stats_handle_created(void *handle) {
+    if (handle != NULL) {
+        __atomic_add_fetch(&handles_created, 1, __ATOMIC_RELAXED);
+    }
+}
+
+void jgrapht_stats_handle_destroyed(void *handle) {
+    if (handle != NULL) {
+        __atomic_add_fetch(&handles_destroyed, 1, __ATOMIC_RELAXED);
+    }
+}
+
+int jgrapht_stats_set_enabled(int value) {
+    __atomic_store_n(&enabled, value != 0, __ATOMIC_RELAXED);
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_stats_is_enabled(int *res) {
+    *res = __atomic_load_n(&enabled, __ATOMIC_RELAXED);
+    return STATUS_SUCCESS;
+}
+
+// Zeroes the counters of all entry points. Handle counts are kept.
+int jgrapht_stats_reset() {
+    pthread_mutex_lock(&entries_lock);
+    for (jgrapht_stats_entry_t *e = entries_head; e != NULL; e = e->next) {
+        __atomic_store_n(&e->calls, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&e->errors, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&e->nanos, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&e->bytes, 0, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&entries_lock);
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_stats_entries_count(int *res) {
+    pthread_mutex_lock(&entries_lock);
+    *res = entries_count;
+    pthread_mutex_unlock(&entries_lock);
+    return STATUS_SUCCESS;
+}
+
+// Entry points are kept in registration order, thus index i stays valid
+// while new entry points are registered.
+int jgrapht_stats_entry(int i, char **name, long long *calls, long long *errors, long long *nanos, long long *bytes) {
+    pthread_mutex_lock(&entries_lock);
+    jgrapht_stats_entry_t *e = NULL;
+    if (i >= 0 && i < entries_count) {
+        for (e = entries_head; i > 0; i--) {
+            e = e->next;
+        }
+    }
+    pthread_mutex_unlock(&entries_lock);
+    if (e == NULL) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Invalid stats entry index");
+    }
+    *name = (char *) e->name;
+    *calls = __atomic_load_n(&e->calls, __ATOMIC_RELAXED);
+    *errors = __atomic_load_n(&e->errors, __ATOMIC_RELAXED);
+    *nanos = __atomic_load_n(&e->nanos, __ATOMIC_RELAXED);
+    *bytes = __atomic_load_n(&e->bytes, __ATOMIC_RELAXED);
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_stats_handles(long long *created, long long *destroyed) {
+    *created = __atomic_load_n(&handles_created, __ATOMIC_RELAXED);
+    *destroyed = __atomic_load_n(&handles_destroyed, __ATOMIC_RELAXED);
+    return STATUS_SUCCESS;
+}
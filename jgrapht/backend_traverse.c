@@ -0,0 +1,275 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Random walks on a csr snapshot of the graph, e.g. for DeepWalk or node2vec
+// corpora. Walk i starts from starts[i % count] and uses its own random
+// number generator seeded from the seed and i, thus the walks do not depend
+// on the number of threads or on how they are split into chunks.
+//
+// Biased walks follow "node2vec: Scalable Feature Learning for Networks",
+// A. Grover and J. Leskovec, 2016. After moving from t to v the next vertex x
+// is chosen proportionally to w(v, x) times 1/p if x is t, 1 if x is a
+// neighbor of t and 1/q otherwise. Candidates are drawn from the first order
+// distribution and accepted with probability proportional to that factor,
+// which avoids precomputing the transition probabilities of every arc.
+
+typedef struct {
+    jgrapht_csr_t *csr;
+    int *starts;
+    int starts_count;
+    long long walks;
+    int length;
+    int weighted;
+    int biased;
+    double return_factor;
+    double inout_factor;
+    double max_factor;
+    unsigned long long seed;
+    int threads;
+    // prefix sums of the arc weights of each vertex
+    double *cumulative;
+    // sorted neighbors of each vertex, for the node2vec factor
+    int *sorted;
+} random_walks_t;
+
+typedef struct {
+    const random_walks_t *rw;
+    long long first;
+    int *matrix;
+    int *lengths;
+} random_walks_ctx_t;
+
+static int compare_int(const void *a, const void *b) {
+    int x = *(const int *) a, y = *(const int *) b;
+    return (x > y) - (x < y);
+}
+
+// the position of the next arc from v according to the arc weights
+static int walk_choose_arc(const random_walks_t *rw, int v, unsigned long long *state) {
+    const jgrapht_csr_t *csr = rw->csr;
+    int begin = csr->out_offsets[v];
+    int end = csr->out_offsets[v + 1];
+    if (!rw->weighted) {
+        return begin + jgrapht_random_int(state, end - begin);
+    }
+    double total = rw->cumulative[end - 1];
+    if (total <= 0.0) {
+        return -1;
+    }
+    double r = jgrapht_random_double(state) * total;
+    // first arc whose prefix sum exceeds r
+    int lo = begin, hi = end - 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (rw->cumulative[mid] > r) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+static int walk_is_neighbor(const random_walks_t *rw, int t, int x) {
+    const jgrapht_csr_t *csr = rw->csr;
+    int begin = csr->out_offsets[t];
+    return bsearch(&x, rw->sorted + begin, csr->out_offsets[t + 1] - begin, sizeof(int), compare_int) != NULL;
+}
+
+static void random_walk_body(void *arg, int worker, int item) {
+    random_walks_ctx_t *ctx = (random_walks_ctx_t *) arg;
+    const random_walks_t *rw = ctx->rw;
+    const jgrapht_csr_t *csr = rw->csr;
+    long long walk = ctx->first + item;
+    int *row = ctx->matrix + (size_t) item * rw->length;
+    unsigned long long state = rw->seed ^ ((unsigned long long) walk * 0xD1B54A32D192ED03ull);
+    jgrapht_random_next(&state);
+    (void) worker;
+
+    int v = rw->starts[walk % rw->starts_count];
+    int previous = -1;
+    int k = 0;
+    row[k++] = csr->vertices[v];
+    while (k < rw->length) {
+        if (csr->out_offsets[v] == csr->out_offsets[v + 1]) {
+            break;
+        }
+        int x;
+        for (;;) {
+            int arc = walk_choose_arc(rw, v, &state);
+            if (arc == -1) {
+                x = -1;
+                break;
+            }
+            x = csr->out_targets[arc];
+            if (!rw->biased || previous == -1) {
+                break;
+            }
+            double factor;
+            if (x == previous) {
+                factor = rw->return_factor;
+            } else if (walk_is_neighbor(rw, previous, x)) {
+                factor = 1.0;
+            } else {
+                factor = rw->inout_factor;
+            }
+            if (jgrapht_random_double(&state) * rw->max_factor < factor) {
+                break;
+            }
+        }
+        if (x == -1) {
+            break;
+        }
+        previous = v;
+        v = x;
+        row[k++] = csr->vertices[v];
+    }
+    if (ctx->lengths != NULL) {
+        ctx->lengths[item] = k;
+    }
+    // walks stuck at a vertex without outgoing arcs are padded
+    while (k < rw->length) {
+        row[k++] = -1;
+    }
+}
+
+int jgrapht_traverse_random_walks_destroy(void *handle) {
+    random_walks_t *rw = (random_walks_t *) handle;
+    if (rw != NULL) {
+        if (rw->csr != NULL) {
+            jgrapht_csr_destroy(rw->csr);
+        }
+        free(rw->starts);
+        free(rw->cumulative);
+        free(rw->sorted);
+        free(rw);
+    }
+    return STATUS_SUCCESS;
+}
+
+// Creates a generator of walks_per_vertex walks with length vertices from each
+// of the given start vertices, or from every vertex if starts is NULL. A p or
+// q different than one enables the node2vec biasing.
+int jgrapht_traverse_random_walks_create(void *g, int *starts, int starts_size, int walks_per_vertex,
+        int length, int weighted, double p, double q, long long int seed, int threads, void** res) {
+    if (walks_per_vertex < 0 || length < 1) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Walk count must be non-negative and length positive");
+    }
+    if (!(p > 0.0) || !(q > 0.0)) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Parameters p and q must be positive");
+    }
+    random_walks_t *rw = calloc(1, sizeof(random_walks_t));
+    if (rw == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    int status;
+    if ((status = jgrapht_csr_create(g, &rw->csr)) != STATUS_SUCCESS) {
+        rw->csr = NULL;
+        jgrapht_traverse_random_walks_destroy(rw);
+        return status;
+    }
+    jgrapht_csr_t *csr = rw->csr;
+    int n = csr->n;
+    int arcs = csr->out_offsets[n];
+    rw->length = length;
+    rw->weighted = weighted && csr->weighted;
+    rw->biased = p != 1.0 || q != 1.0;
+    rw->return_factor = 1.0 / p;
+    rw->inout_factor = 1.0 / q;
+    rw->max_factor = 1.0;
+    if (rw->return_factor > rw->max_factor) {
+        rw->max_factor = rw->return_factor;
+    }
+    if (rw->inout_factor > rw->max_factor) {
+        rw->max_factor = rw->inout_factor;
+    }
+    rw->seed = (unsigned long long) seed;
+    rw->threads = jgrapht_parallel_threads(threads);
+
+    rw->starts_count = starts != NULL ? starts_size : n;
+    rw->starts = malloc(sizeof(int) * (rw->starts_count > 0 ? rw->starts_count : 1));
+    if (rw->starts == NULL) {
+        jgrapht_traverse_random_walks_destroy(rw);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    if (starts != NULL) {
+        if ((status = jgrapht_csr_indices_of(csr, starts, starts_size, rw->starts)) != STATUS_SUCCESS) {
+            jgrapht_traverse_random_walks_destroy(rw);
+            return status;
+        }
+    } else {
+        for (int v = 0; v < n; v++) {
+            rw->starts[v] = v;
+        }
+    }
+    rw->walks = (long long) rw->starts_count * walks_per_vertex;
+
+    if (rw->weighted) {
+        if (csr->negative_weights) {
+            jgrapht_traverse_random_walks_destroy(rw);
+            return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Negative edge weights not allowed");
+        }
+        rw->cumulative = malloc(sizeof(double) * (arcs > 0 ? arcs : 1));
+        if (rw->cumulative == NULL) {
+            jgrapht_traverse_random_walks_destroy(rw);
+            return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        }
+        for (int v = 0; v < n; v++) {
+            double total = 0.0;
+            for (int k = csr->out_offsets[v]; k < csr->out_offsets[v + 1]; k++) {
+                total += csr->out_weights[k];
+                rw->cumulative[k] = total;
+            }
+        }
+    }
+    if (rw->biased) {
+        rw->sorted = malloc(sizeof(int) * (arcs > 0 ? arcs : 1));
+        if (rw->sorted == NULL) {
+            jgrapht_traverse_random_walks_destroy(rw);
+            return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+        }
+        memcpy(rw->sorted, csr->out_targets, sizeof(int) * arcs);
+        for (int v = 0; v < n; v++) {
+            int begin = csr->out_offsets[v];
+            qsort(rw->sorted + begin, csr->out_offsets[v + 1] - begin, sizeof(int), compare_int);
+        }
+    }
+    *res = rw;
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_traverse_random_walks_count(void *handle, long long int* res) {
+    *res = ((random_walks_t *) handle)->walks;
+    return STATUS_SUCCESS;
+}
+
+// Writes the walks first, first+1, ... into consecutive rows of matrix, as
+// many as fit and exist. Each row has length entries, vertices missing from
+// walks which got stuck are -1. Since -1 may also be a vertex, the number of
+// vertices of each walk is written into lengths unless it is NULL.
+int jgrapht_traverse_random_walks_fill(void *handle, long long int first, int *matrix, int matrix_size,
+        int *lengths, int lengths_size, int* res) {
+    random_walks_t *rw = (random_walks_t *) handle;
+    if (first < 0) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Negative walk index");
+    }
+    long long rows = matrix_size / rw->length;
+    if (lengths != NULL && rows > lengths_size) {
+        rows = lengths_size;
+    }
+    if (first >= rw->walks) {
+        rows = 0;
+    } else if (rows > rw->walks - first) {
+        rows = rw->walks - first;
+    }
+    if (rows > 0) {
+        random_walks_ctx_t ctx = { rw, first, matrix, lengths };
+        int threads = rows < rw->threads ? (int) rows : rw->threads;
+        jgrapht_parallel_for((int) rows, threads, 64, random_walk_body, &ctx);
+    }
+    *res = (int) rows;
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,159 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "backend.h"
+#include "backend_csr.h"
+
+// Weighted views, graph handles whose edge weights come from an array indexed
+// by edge id instead of the graph. The view itself is an unmodifiable view of
+// the graph, the array is kept by the backend and consulted by the weight
+// functions of the backend, thus also by every algorithm working on a graph
+// snapshot. Swapping the array only copies the weights.
+
+typedef struct weights_overlay {
+    void *graph;
+    double *weights;
+    int size;
+    struct weights_overlay *next;
+} weights_overlay_t;
+
+static pthread_mutex_t overlays_lock = PTHREAD_MUTEX_INITIALIZER;
+static weights_overlay_t *overlays = NULL;
+static int overlays_count = 0;
+
+// must be called with the lock held
+static weights_overlay_t *overlay_find(void *g) {
+    for (weights_overlay_t *o = overlays; o != NULL; o = o->next) {
+        if (o->graph == g) {
+            return o;
+        }
+    }
+    return NULL;
+}
+
+static int overlay_weight(const weights_overlay_t *o, int e, double *res) {
+    if (e < 0 || e >= o->size) {
+        return jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Edge without weight in the weighted view");
+    }
+    *res = o->weights[e];
+    return STATUS_SUCCESS;
+}
+
+int jgrapht_weights_overlay_is_active(void *g) {
+    if (__atomic_load_n(&overlays_count, __ATOMIC_ACQUIRE) == 0) {
+        return 0;
+    }
+    pthread_mutex_lock(&overlays_lock);
+    int found = overlay_find(g) != NULL;
+    pthread_mutex_unlock(&overlays_lock);
+    return found;
+}
+
+// Reads the weights of the given edges from the overlay of a view. Returns
+// zero and leaves status untouched if the graph is not a weighted view.
+int jgrapht_weights_overlay_get(void *g, int *edges, int size, double *weights, int *status) {
+    if (__atomic_load_n(&overlays_count, __ATOMIC_ACQUIRE) == 0) {
+        return 0;
+    }
+    pthread_mutex_lock(&overlays_lock);
+    weights_overlay_t *o = overlay_find(g);
+    if (o != NULL) {
+        *status = STATUS_SUCCESS;
+        for (int i = 0; i < size && *status == STATUS_SUCCESS; i++) {
+            *status = overlay_weight(o, edges[i], weights + i);
+        }
+    }
+    pthread_mutex_unlock(&overlays_lock);
+    return o != NULL;
+}
+
+// Writes weights into the overlay of a view, with the same contract as
+// jgrapht_weights_overlay_get.
+int jgrapht_weights_overlay_set(void *g, int *edges, int size, double *weights, int *status) {
+    if (__atomic_load_n(&overlays_count, __ATOMIC_ACQUIRE) == 0) {
+        return 0;
+    }
+    pthread_mutex_lock(&overlays_lock);
+    weights_overlay_t *o = overlay_find(g);
+    if (o != NULL) {
+        *status = STATUS_SUCCESS;
+        for (int i = 0; i < size; i++) {
+            if (edges[i] < 0 || edges[i] >= o->size) {
+                *status = jgrapht_error_set_errno(STATUS_INDEX_OUT_OF_BOUNDS, "Edge without weight in the weighted view");
+                break;
+            }
+        }
+        for (int i = 0; i < size && *status == STATUS_SUCCESS; i++) {
+            o->weights[edges[i]] = weights[i];
+        }
+    }
+    pthread_mutex_unlock(&overlays_lock);
+    return o != NULL;
+}
+
+void jgrapht_weights_overlay_remove(void *g) {
+    if (__atomic_load_n(&overlays_count, __ATOMIC_ACQUIRE) == 0) {
+        return;
+    }
+    pthread_mutex_lock(&overlays_lock);
+    for (weights_overlay_t **p = &overlays; *p != NULL; p = &(*p)->next) {
+        weights_overlay_t *o = *p;
+        if (o->graph == g) {
+            *p = o->next;
+            __atomic_sub_fetch(&overlays_count, 1, __ATOMIC_RELEASE);
+            free(o->weights);
+            free(o);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&overlays_lock);
+}
+
+// Creates a view of the graph whose weight of edge e is weights[e]. The view
+// is destroyed with jgrapht_handles_destroy like every other view.
+int jgrapht_graph_as_weighted(void *g, double *weights, int weights_size, void** res) {
+    weights_overlay_t *o = calloc(1, sizeof(weights_overlay_t));
+    if (o == NULL || (o->weights = malloc(sizeof(double) * (weights_size > 0 ? weights_size : 1))) == NULL) {
+        free(o);
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    memcpy(o->weights, weights, sizeof(double) * weights_size);
+    o->size = weights_size;
+    int status;
+    if ((status = jgrapht_graph_as_unmodifiable(g, &o->graph)) != STATUS_SUCCESS) {
+        free(o->weights);
+        free(o);
+        return status;
+    }
+    pthread_mutex_lock(&overlays_lock);
+    o->next = overlays;
+    overlays = o;
+    __atomic_add_fetch(&overlays_count, 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&overlays_lock);
+    *res = o->graph;
+    return STATUS_SUCCESS;
+}
+
+// Replaces all weights of a weighted view, the array may have a different size.
+int jgrapht_graph_weighted_view_set_weights(void *view, double *weights, int weights_size) {
+    double *copy = malloc(sizeof(double) * (weights_size > 0 ? weights_size : 1));
+    if (copy == NULL) {
+        return jgrapht_error_set_errno(STATUS_ERROR, "Failed to allocate memory");
+    }
+    memcpy(copy, weights, sizeof(double) * weights_size);
+    pthread_mutex_lock(&overlays_lock);
+    weights_overlay_t *o = overlay_find(view);
+    if (o != NULL) {
+        double *old = o->weights;
+        o->weights = copy;
+        o->size = weights_size;
+        copy = old;
+    }
+    pthread_mutex_unlock(&overlays_lock);
+    free(copy);
+    if (o == NULL) {
+        return jgrapht_error_set_errno(STATUS_ILLEGAL_ARGUMENT, "Graph is not a weighted view");
+    }
+    return STATUS_SUCCESS;
+}
@@ -1,5 +1,7 @@
 import time
 import ctypes
+import codecs
+import io
 
 from .. import backend
 from .._internals._wrappers import (
@@ -12,37 +14,112 @@ from .._internals._attributes import (
 from .._internals._paths import _JGraphTGraphPath
 
 
-def _export_to_file(name, graph, filename, *args):
-    alg_method_name = "jgrapht_export_file_" + name
+class _ExportSink:
+    """Adapts a file-like object or a writable buffer to a backend sink, which
+    receives the output in chunks.
+    """
+
+    def __init__(self, target, binary=False):
+        self._written = 0
+        self._error = None
+        self._write = None
+        self._buffer = None
+        self._flush = None
+        if hasattr(target, "write"):
+            if isinstance(target, io.TextIOBase):
+                if binary:
+                    raise TypeError("Binary file-like object or writable buffer expected")
+                # chunks may split multibyte characters
+                decoder = codecs.getincrementaldecoder("utf-8")()
+                self._write = lambda data: target.write(decoder.decode(data))
+                self._flush = lambda: target.write(decoder.decode(b"", final=True))
+            else:
+                self._write = target.write
+        else:
+            view = memoryview(target).cast("B")
+            if view.readonly:
+                raise TypeError("Writable buffer or file-like object expected")
+            self._buffer = (ctypes.c_char * len(view)).from_buffer(view)
+
+        callback_ctype = ctypes.CFUNCTYPE(ctypes.c_int, ctypes.c_void_p, ctypes.c_longlong)
+        self._callback = callback_ctype(self._sink)
+        self.f_ptr = ctypes.cast(self._callback, ctypes.c_void_p).value
+
+    def _sink(self, data, size):
+        try:
+            if self._buffer is not None:
+                if self._written + size > len(self._buffer):
+                    raise ValueError("Buffer too small for the output")
+                ctypes.memmove(ctypes.addressof(self._buffer) + self._written, data, size)
+            else:
+                self._write(ctypes.string_at(data, size))
+            self._written += size
+            return 0
+        except Exception as e:
+            self._error = e
+            return 1
+
+    def run(self, alg_method, *args):
+        """Call a backend export function with the sink as its last argument."""
+        try:
+            alg_method(*args, self.f_ptr)
+        except IOError:
+            if self._error is not None:
+                raise self._error
+            raise
+        if self._flush is not None:
+            self._flush()
+        return self._written
+
+
+def _export_to_sink(name, graph, sink, *args):
+    handle = _export_string_handle(name, graph, *args)
+    return _ExportSink(sink).run(backend.jgrapht_export_sink_string, handle)
+
+
+def _export_string_handle(name, graph, *args):
+    alg_method_name = "jgrapht_export_string_" + name
 
     try:
         alg_method = getattr(backend, alg_method_name)
     except AttributeError:
         raise NotImplementedError("Algorithm {} not supported.".format(name))
 
-    alg_method(graph.handle, filename, *args)
+    return _JGraphTString(alg_method(graph.handle, *args))
 
 
-def _export_to_string(name, graph, *args):
-    alg_method_name = "jgrapht_export_string_" + name
+def _export_to_file(name, graph, filename, *args):
+    if not isinstance(filename, str):
+        return _export_to_sink(name, graph, filename, *args)
+
+    alg_method_name = "jgrapht_export_file_" + name
 
     try:
         alg_method = getattr(backend, alg_method_name)
     except AttributeError:
         raise NotImplementedError("Algorithm {} not supported.".format(name))
 
-    handle = alg_method(graph.handle, *args)
+    alg_method(graph.handle, filename, *args)
+
 
-    return str(_JGraphTString(handle))
+def _export_to_string(name, graph, *args):
+    return str(_export_string_handle(name, graph, *args))
 
 
 def _attributes_to_store(attributes_dict):
     vertex_attribute_store = None
     if attributes_dict is not None:
-        vertex_attribute_store = _JGraphTAttributeStore()
+        # group by key in order to use a single backend call per key
+        columns = dict()
         for element, attr_dict in attributes_dict.items():
             for key, value in attr_dict.items():
-                vertex_attribute_store.put(element, key, value)
+                elements, values = columns.setdefault(key, ([], []))
+                elements.append(element)
+                values.append(value)
+
+        vertex_attribute_store = _JGraphTAttributeStore()
+        for key, (elements, values) in columns.items():
+            vertex_attribute_store.put_column(key, elements, values)
 
     return vertex_attribute_store
 
@@ -285,7 +362,9 @@ def generate_gml(
     return _export_to_string("gml", graph, *custom)
 
 
-def write_json(graph, filename, per_vertex_attrs_dict=None, per_edge_attrs_dict=None):
+def write_json(
+    graph, filename, per_vertex_attrs_dict=None, per_edge_attrs_dict=None, threads=None
+):
     """Exports a graph using `JSON <https://tools.ietf.org/html/rfc8259>`_.
 
     The output is one object which contains:
@@ -300,12 +379,25 @@ def write_json(graph, filename, per_vertex_attrs_dict=None, per_edge_attrs_dict=
 
     .. note:: Custom attributes are supported with per vertex and per edge dictionaries. 
 
+    .. note:: When threads is not None and no attributes are given, the output is formatted
+              in parallel by native code and edge weights different from 1.0 are written as
+              a weight member. Otherwise the threads parameter is ignored.
+
     :param graph: The graph to export
     :param filename: Filename to write
     :param per_vertex_attrs_dict: per vertex attribute dicts
     :param per_edge_attrs_dict: per edge attribute dicts
+    :param threads: number of threads used to format the output. If 0, the number of
+                    processors is used. If None, the single threaded exporter is used.
     :raises IOError: In case of an export error 
     """
+    if threads is not None and per_vertex_attrs_dict is None and per_edge_attrs_dict is None:
+        if not isinstance(filename, str):
+            return _ExportSink(filename).run(
+                backend.jgrapht_export_sink_json_parallel, graph.handle, threads
+            )
+        return backend.jgrapht_export_file_json_parallel(graph.handle, filename, threads)
+
     vertex_attribute_store = _attributes_to_store(per_vertex_attrs_dict)
     edge_attribute_store = _attributes_to_store(per_edge_attrs_dict)
 
@@ -365,6 +457,7 @@ def write_csv(
     export_edge_weights=False,
     matrix_format_nodeid=False,
     matrix_format_zero_when_no_edge=True,
+    threads=None,
 ):
     """Export a graph using the CSV format.
 
@@ -379,9 +472,22 @@ def write_csv(
     :param matrix_format_node_id: only for the matrix format, whether to export node identifiers
     :param matrix_format_zero_when_noedge: only for the matrix format, whether the output should contain
            zero for missing edges
+    :param threads: only for the edgelist format, number of threads used to format the output.
+           If 0, the number of processors is used. If None, the single threaded exporter is used.
     :raises IOError: in case of an export error
     """
     format = CSV_FORMATS.get(format, backend.CSV_FORMAT_ADJACENCY_LIST)
+    if threads is not None and format == backend.CSV_FORMAT_EDGE_LIST:
+        if not isinstance(filename, str):
+            return _ExportSink(filename).run(
+                backend.jgrapht_export_sink_csv_edgelist_parallel,
+                graph.handle,
+                export_edge_weights,
+                threads,
+            )
+        return backend.jgrapht_export_file_csv_edgelist_parallel(
+            graph.handle, filename, export_edge_weights, threads
+        )
     custom = [
         format,
         export_edge_weights,
@@ -679,3 +785,26 @@ def generate_sparse6(graph):
     :raises IOError: In case of an export error
     """
     return _export_to_string("sparse6", graph)
+
+
+def write_binary(graph, filename):
+    """Exports a graph to the native binary snapshot format.
+
+    The format stores the graph in compressed sparse row layout, consisting of a small
+    header followed by the vertices, the offsets of the outgoing edges of each vertex, the
+    edge targets, the edge identifiers and, for weighted graphs, the edge weights. It is
+    not intended for interchange with other tools but for saving and reloading large
+    graphs quickly. Numbers are written in the byte order of the machine.
+
+    Vertex and edge attributes are not stored. Undirected edges are stored once.
+
+    :param graph: The graph to export
+    :param filename: Filename to write, a binary file-like object or a writable buffer
+    :raises IOError: In case of an export error
+    :raises TypeError: If given a text file-like object
+    """
+    if not isinstance(filename, str):
+        return _ExportSink(filename, binary=True).run(
+            backend.jgrapht_export_sink_binary, graph.handle
+        )
+    return backend.jgrapht_export_file_binary(graph.handle, filename)
@@ -2,6 +2,9 @@ import time
 import ctypes
 
 from .. import backend
+from .._internals._graphs import _JGraphTGraph
+from .._internals._io import _JGraphTEdgeListStreamImporter
+from .._internals._attributes import _JGraphTAttributeColumns
 from .._internals._paths import _JGraphTGraphPath
 
 
@@ -30,7 +33,10 @@ def _create_wrapped_callback(callback, cfunctype):
     return (0, None)
 
 
-def _create_wrapped_attribute_callback(callback):
+def _create_wrapped_attribute_callback(callback, edges=False):
+    if isinstance(callback, _JGraphTAttributeColumns):
+        # attributes are collected in the backend without calling back into python
+        return (callback._callback_ptr(edges), callback)
     if callback is not None:
         callback_ctype = ctypes.CFUNCTYPE(
             None, ctypes.c_int, ctypes.c_char_p, ctypes.c_char_p
@@ -61,6 +67,33 @@ def _create_wrapped_import_id_callback(callback):
         return (0, None)
 
 
+def create_attribute_columns():
+    """Create columns which collect attributes during an import.
+
+    Reading attributes using a callback means calling a Python function for each
+    attribute of each vertex or edge of the input. For large inputs with many attributes
+    this dominates the import time. Instead, the object returned by this function can be
+    passed as the vertex or edge attribute callback of any importer. Attributes are then
+    collected by the backend and no Python code runs until the import finishes.
+
+    The result is a mapping from attribute keys to a tuple (ids, values), where ids is
+    an array with the vertex or edge identifiers having the attribute and values are the
+    corresponding attribute values. Values are returned as an integer array if all of them
+    are integers, as a double array if all of them are numbers and as a list of strings
+    otherwise. A separate object should be used for vertices and for edges.
+
+    Example::
+
+        vertex_columns = create_attribute_columns()
+        read_graphml(graph, filename, vertex_attribute_cb=vertex_columns)
+        ids, colors = vertex_columns['color']
+
+    :returns: attribute columns
+    :rtype: :py:class:`collections.abc.Mapping`
+    """
+    return _JGraphTAttributeColumns()
+
+
 def read_dimacs(graph, filename, preserve_ids_from_input=True):
     """Read graph in DIMACS format. 
 
@@ -220,7 +253,7 @@ def read_gml(
     :raises IOError: In case of an import error 
     """
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [preserve_ids_from_input, vertex_attribute_f_ptr, edge_attribute_f_ptr]
     return _import("file_gml", graph, filename, *args)
@@ -301,7 +334,7 @@ def parse_gml(
     :raises IOError: In case of an import error 
     """
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [preserve_ids_from_input, vertex_attribute_f_ptr, edge_attribute_f_ptr]
     return _import("string_gml", graph, input_string, *args)
@@ -363,7 +396,7 @@ def read_json(
     """
     import_id_f_ptr, _ = _create_wrapped_import_id_callback(import_id_cb)
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [import_id_f_ptr, vertex_attribute_f_ptr, edge_attribute_f_ptr]
     return _import("file_json", graph, filename, *args)
@@ -429,7 +462,7 @@ def parse_json(
     """
     import_id_f_ptr, _ = _create_wrapped_import_id_callback(import_id_cb)
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [import_id_f_ptr, vertex_attribute_f_ptr, edge_attribute_f_ptr]
     return _import("string_json", graph, input_string, *args)
@@ -607,7 +640,7 @@ def read_gexf(
     import_id_f_ptr, _ = _create_wrapped_import_id_callback(import_id_cb)
 
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [
         import_id_f_ptr,
@@ -698,7 +731,7 @@ def parse_gexf(
     import_id_f_ptr, _ = _create_wrapped_import_id_callback(import_id_cb)
 
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [
         import_id_f_ptr,
@@ -751,7 +784,7 @@ def read_dot(
     import_id_f_ptr, _ = _create_wrapped_import_id_callback(import_id_cb)
 
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [ import_id_f_ptr, vertex_attribute_f_ptr, edge_attribute_f_ptr ]
     return _import("file_dot", graph, filename, *args)
@@ -797,7 +830,7 @@ def parse_dot(
     import_id_f_ptr, _ = _create_wrapped_import_id_callback(import_id_cb)
 
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [ import_id_f_ptr, vertex_attribute_f_ptr, edge_attribute_f_ptr ]
     return _import("string_dot", graph, input_string, *args)
@@ -846,7 +879,7 @@ def read_graph6sparse6(
     import_id_f_ptr, _ = _create_wrapped_import_id_callback(import_id_cb)
 
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [ import_id_f_ptr, vertex_attribute_f_ptr, edge_attribute_f_ptr ]
     return _import("file_graph6sparse6", graph, filename, *args)    
@@ -895,7 +928,114 @@ def parse_graph6sparse6(
     """
     import_id_f_ptr, _ = _create_wrapped_import_id_callback(import_id_cb)
     vertex_attribute_f_ptr, _ = _create_wrapped_attribute_callback(vertex_attribute_cb)
-    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb)
+    edge_attribute_f_ptr, _ = _create_wrapped_attribute_callback(edge_attribute_cb, edges=True)
 
     args = [ import_id_f_ptr, vertex_attribute_f_ptr, edge_attribute_f_ptr ]
     return _import("string_graph6sparse6", graph, input_string, *args)    
+
+
+def read_binary(filename):
+    """Imports a graph from a file in the native binary snapshot format.
+
+    See :py:meth:`jgrapht.io.exporters.write_binary` for a description of the format. The
+    file is memory mapped and read without any text parsing. The sparse graph itself is
+    still built from an edge list in the isolate, which receives the edges one call per
+    edge, thus loading is bounded by these calls rather than by disk bandwidth.
+
+    Contrary to the other importers, this function does not accept a graph to read into.
+    Instead it always returns a new sparse graph, directed and weighted according to the
+    file. Vertex identifiers are preserved. Since sparse graphs have a continuous range of
+    vertices, the result contains all vertices from 0 up to the largest identifier in the
+    file. Edge identifiers are also preserved if they form a continuous range starting from
+    0, which is always the case for files written from sparse graphs.
+
+    .. note :: Sparse graphs are unmodifiable, see :py:meth:`jgrapht.create_sparse_graph`.
+
+    :param filename: the filename to read from
+    :returns: a sparse graph
+    :rtype: :class:`jgrapht.types.Graph`
+    :raises IOError: in case of an import error
+    """
+    handle = backend.jgrapht_import_file_binary(filename)
+    return _JGraphTGraph(handle)
+
+
+def create_edgelist_importer(directed=True, weighted=False, delimiter=",", import_id_cb=None):
+    """Create a streaming importer for edge lists.
+
+    The importer is fed with the input in blocks of any size, using its :code:`push`
+    method, which accepts bytes or strings. Lines may span several blocks. Calling
+    :code:`finish` builds a sparse graph out of all edges pushed and returns it. Since
+    only the edges parsed so far are kept, and not the input, memory consumption stays
+    close to the size of the final graph. During :code:`finish` the edges are handed to
+    the isolate one call per edge, since the isolate creates sparse graphs only from an
+    edge list, and both the parsed edges and the graph are held until it returns.
+
+    Each line contains the source vertex, the target vertex and, for weighted graphs,
+    optionally the edge weight, separated by the delimiter. Edges without a weight get a
+    weight of 1.0. Empty lines and lines starting with '#' are skipped.
+
+    If the input already contains non-negative integer identifiers, leave the import
+    identifier callback as None. Parsing then happens completely inside the backend
+    without calling back into Python. Otherwise the callback is called once for each
+    distinct identifier and must return a non-negative integer.
+
+    The resulting graph is a sparse graph. Its vertices are 0 up to the largest vertex
+    read (or the number of vertices given to finish) and edges are numbered in input
+    order starting from 0.
+
+    :param directed: whether the graph should be directed
+    :param weighted: whether the graph should be weighted
+    :param delimiter: the single character separating the fields of a line. Whitespace
+      around fields is ignored and when the delimiter is whitespace, any run of
+      whitespace separates fields
+    :param import_id_cb: callback to transform identifiers from the input to integer
+      vertices. Can be None if the input already contains integers
+    :returns: an importer with methods push(data) and finish(num_vertices=None)
+    :raises IOError: in case of an import error
+    """
+    handle = backend.jgrapht_import_edgelist_stream_create(directed, weighted, delimiter)
+    return _JGraphTEdgeListStreamImporter(handle, weighted, delimiter, import_id_cb)
+
+
+def read_edgelist_stream(
+    source,
+    directed=True,
+    weighted=False,
+    delimiter=",",
+    import_id_cb=None,
+    num_vertices=None,
+    block_size=1 << 20,
+):
+    """Imports a sparse graph from an edge list read incrementally from a file object.
+
+    The input is read and parsed in blocks, thus it is never materialized completely.
+    See :py:meth:`create_edgelist_importer` for a description of the format. Any object
+    with a :code:`read(size)` method is supported, such as files opened in binary or
+    text mode. Sockets can be wrapped using :code:`socket.makefile("rb")`.
+
+    :param source: the file object to read from
+    :param directed: whether the graph should be directed
+    :param weighted: whether the graph should be weighted
+    :param delimiter: the single character separating the fields of a line
+    :param import_id_cb: callback to transform identifiers from the input to integer
+      vertices. Can be None if the input already contains integers
+    :param num_vertices: number of vertices of the graph. If None, the largest vertex
+      plus one
+    :param block_size: number of bytes or characters to read at once
+    :returns: a sparse graph
+    :rtype: :class:`jgrapht.types.Graph`
+    :raises IOError: in case of an import error
+    """
+    importer = create_edgelist_importer(
+        directed=directed,
+        weighted=weighted,
+        delimiter=delimiter,
+        import_id_cb=import_id_cb,
+    )
+    while True:
+        block = source.read(block_size)
+        if not block:
+            break
+        importer.push(block)
+    return importer.finish(num_vertices=num_vertices)
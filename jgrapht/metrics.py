@@ -3,6 +3,7 @@ from ._internals._collections import (
     _JGraphTIntegerDoubleMap,
     _JGraphTIntegerSet,
 )
+from ._internals._metrics import _JGraphTMetricsTracker
 
 
 def diameter(graph):
@@ -50,19 +51,61 @@ def girth(graph):
     return backend.jgrapht_graph_metrics_girth(graph.handle)
 
 
-def count_triangles(graph):
+def count_triangles(graph, threads=None):
     r"""Count the number of triangles in a graph.
 
     This is an :math:`\mathcal{O}(m^{3/2})` algorithm for counting the number of 
     triangles in an undirected graph.
 
+    If threads is given the count is computed by the native backend on a snapshot of 
+    the graph. Edges are oriented towards the endpoint with the larger degree and the 
+    sorted forward neighborhoods of the endpoints of every edge are intersected, in 
+    parallel over the vertices. Self-loops and multiple edges are ignored.
+
     :param graph: the input graph. Must be undirected
+    :param threads: number of threads for the native count, zero or negative for the 
+      number of processors. If None the count of the JGraphT library is used
     :returns: the number of triangles in the graph 
     :raises ValueError: if the graph is not undirected
     """
+    if threads is not None:
+        return backend.jgrapht_graph_metrics_triangles_parallel(graph.handle, threads)
     return backend.jgrapht_graph_metrics_triangles(graph.handle)
 
 
+def triangle_tracker(graph):
+    r"""Maintain the triangle count and the clustering coefficients of a graph while it 
+    is modified.
+
+    The tracker counts the triangles once and then updates the counts on every vertex 
+    or edge addition and removal made through the graph. Adding or removing an edge 
+    :math:`(u, v)` costs :math:`\mathcal{O}(\min(d(u), d(v)))` expected time, 
+    removing a vertex also scans all edges. The tracker exposes
+
+     * the number of triangles in the graph,
+     * the number of triangles of each vertex,
+     * the local clustering coefficient of each vertex,
+     * the global clustering coefficient (transitivity) and the average clustering 
+       coefficient.
+
+    Counts refer to the simple graph underlying the input, self-loops are ignored 
+    and multiple edges count once.
+
+    .. note :: Modifications made through the methods of the graph or of any view of it, 
+      such as :py:meth:`jgrapht.views.as_unweighted`, are tracked. Importers and 
+      generators modify the graph inside the isolate. Afterwards the tracker raises a 
+      RuntimeError and a new tracker is required.
+
+    :param graph: the input graph. Must be undirected
+    :returns: a tracker with properties triangles, global_clustering_coefficient and 
+      average_clustering_coefficient and methods vertex_triangles,
+      local_clustering_coefficient, vertices_triangles and local_clustering_coefficients
+    :raises ValueError: if the graph is not undirected
+    """
+    handle = backend.jgrapht_graph_metrics_tracker_create(graph.handle)
+    return _JGraphTMetricsTracker(handle, graph)
+
+
 def measure(graph): 
     """Measure the graph. This method executes an all-pairs shortest paths 
     using Floyd-Warshal.
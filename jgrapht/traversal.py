@@ -1,5 +1,7 @@
 from . import backend
 from ._internals._wrappers import _JGraphTIntegerIterator
+from ._internals._walks import _JGraphTRandomWalks
+from ._internals._arrays import _as_int_array, _int_array
 
 import time
 
@@ -107,6 +109,110 @@ def random_walk_traversal(
     return _JGraphTIntegerIterator(it)
 
 
+def _random_walks(graph, walks_per_vertex, walk_length, start_vertices, weighted, p, q, seed, parallelism):
+    if seed is None:
+        seed = int(time.time())
+    if start_vertices is not None:
+        start_vertices = _as_int_array(start_vertices)
+    handle = backend.jgrapht_traverse_random_walks_create(
+        graph.handle,
+        start_vertices,
+        walks_per_vertex,
+        walk_length,
+        weighted,
+        p,
+        q,
+        seed,
+        parallelism,
+    )
+    return _JGraphTRandomWalks(handle, walk_length)
+
+
+def random_walks(
+    graph,
+    walks_per_vertex=10,
+    walk_length=80,
+    start_vertices=None,
+    weighted=False,
+    p=1.0,
+    q=1.0,
+    seed=None,
+    parallelism=1,
+    out=None,
+    with_lengths=False,
+):
+    r"""Generate a corpus of random walks, e.g. for DeepWalk or node2vec embeddings.
+
+    Walk i starts from start_vertices[i % k] where k is the number of start vertices, thus 
+    the corpus contains walks_per_vertex rounds with one walk from each start vertex. All 
+    walks are computed natively and in parallel. Each walk uses its own random number 
+    generator derived from the seed, so the result does not depend on the parallelism.
+
+    When p or q differ from one the walks are biased as in node2vec. After moving from
+    t to v the next vertex x is chosen with probability proportional to :math:`w(v,x)/p`
+    if x is t, :math:`w(v,x)` if x is a neighbor of t and :math:`w(v,x)/q` otherwise.
+
+    See the paper:
+
+     * A. Grover and J. Leskovec. node2vec: Scalable Feature Learning for Networks.
+       KDD 2016.
+
+    :param graph: the graph. Directed graphs are walked along outgoing edges
+    :param walks_per_vertex: number of walks from each start vertex
+    :param walk_length: number of vertices of each walk
+    :param start_vertices: an iterable or array of start vertices. If None all vertices
+    :param weighted: whether to select edges based on their weights, otherwise a uniform weight
+      function is assumed
+    :param p: the return parameter of node2vec
+    :param q: the in-out parameter of node2vec
+    :param seed: seed for the random number generator. If None the system time is used.
+    :param parallelism: number of threads to use. If zero or less all processors are used
+    :param out: an optional writable buffer of 32-bit integers with at least 
+      walks times walk_length elements, such as an :py:class:`array.array` or numpy array.
+      Corpora with more than :math:`2^{31}-1` entries are written in several backend calls
+    :param with_lengths: whether to also return the number of vertices of each walk
+    :returns: the buffer containing the walks in row-major order. Walks which reach a vertex
+      without outgoing edges are padded with -1. Since -1 may also be a vertex of the graph,
+      use with_lengths to tell the padding apart. In that case a tuple of the buffer and an
+      integer array with the length of each walk is returned
+    """
+    walks = _random_walks(graph, walks_per_vertex, walk_length, start_vertices, weighted, p, q, seed, parallelism)
+    if out is None:
+        out = _int_array(len(walks) * walk_length)
+    if with_lengths:
+        lengths = _int_array(len(walks))
+        walks.fill_all(out, lengths)
+        return out, lengths
+    walks.fill_all(out)
+    return out
+
+
+def random_walks_chunks(
+    graph,
+    walks_per_vertex=10,
+    walk_length=80,
+    start_vertices=None,
+    weighted=False,
+    p=1.0,
+    q=1.0,
+    seed=None,
+    parallelism=1,
+    walks_per_chunk=4096,
+    with_lengths=False,
+):
+    r"""Generate the same corpus as :py:meth:`random_walks` in chunks. Each chunk is
+    computed only when requested, thus the whole corpus never needs to fit in memory.
+
+    :param walks_per_chunk: maximum number of walks of each chunk
+    :param with_lengths: whether to also yield the number of vertices of each walk
+    :returns: an iterator over integer arrays, each containing up to walks_per_chunk walks in 
+      row-major order. If with_lengths is set the iterator yields tuples of such an array and 
+      an integer array with the length of each of its walks
+    """
+    walks = _random_walks(graph, walks_per_vertex, walk_length, start_vertices, weighted, p, q, seed, parallelism)
+    return walks.chunks(walks_per_chunk, with_lengths)
+
+
 def max_cardinality_traversal(graph):
     """A maximum cardinality search iterator for undirected graphs. 
     
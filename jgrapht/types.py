@@ -1,5 +1,7 @@
 from abc import ABC, abstractmethod
 
+from array import array
+
 from collections.abc import (
     Mapping,
 )
@@ -173,6 +175,47 @@ class AllPairsPaths(ABC):
         pass
 
 
+class ShortestPathIndex(ABC):
+    """A preprocessed index which answers point-to-point shortest path queries.
+    The index is built from a snapshot of the graph and does not reflect later
+    modifications of the graph.
+    """
+
+    @abstractmethod
+    def query(self, source_vertex, target_vertex):
+        """Get a shortest path between two vertices.
+
+        :param source_vertex: the source vertex
+        :param target_vertex: the target vertex
+        :returns: a shortest path or None if the target is not reachable
+        :rtype: :py:class:`.GraphPath`
+        """
+        pass
+
+    @abstractmethod
+    def distance(self, source_vertex, target_vertex):
+        """Get the shortest path distance between two vertices.
+
+        :param source_vertex: the source vertex
+        :param target_vertex: the target vertex
+        :returns: the distance, infinity if the target is not reachable
+        :rtype: float
+        """
+        pass
+
+    @abstractmethod
+    def query_many(self, source_vertices, target_vertices, parallelism=1):
+        """Get the shortest path distances of many pairs of vertices.
+
+        :param source_vertices: an iterable or array of source vertices
+        :param target_vertices: an iterable or array of target vertices, of the same length
+        :param parallelism: number of threads to use. If zero or less all processors are used
+        :returns: the distances, infinity for unreachable targets
+        :rtype: :py:class:`array.array`
+        """
+        pass
+
+
 class Graph(ABC):
     """A graph."""
 
@@ -217,6 +260,15 @@ class Graph(ABC):
             added.append(x)
         return added
 
+    def create_vertices(self, count):
+        """Create many vertices in the graph.
+
+        :param count: the number of vertices to create
+        :returns: the new vertex identifiers
+        :rtype: :py:class:`array.array`
+        """
+        return array("i", (self.create_vertex() for _ in range(count)))
+
     @abstractmethod
     def remove_vertex(self, v):
         """Remove a vertex from the graph.
@@ -275,6 +327,38 @@ class Graph(ABC):
             created.append(e)
         return created
 
+    def create_edges_from_arrays(self, sources, targets, weights=None):
+        """Create many edges given as parallel arrays. Position i describes an edge
+        from sources[i] to targets[i] with weight weights[i].
+
+        If an edge cannot be created, an error is raised and the edges which precede
+        it remain in the graph.
+
+        :param sources: an iterable or array of source vertices
+        :param targets: an iterable or array of target vertices
+        :param weights: an optional iterable or array of edge weights
+        :returns: the new edge identifiers
+        :rtype: :py:class:`array.array`
+        """
+        sources = array("i", sources)
+        targets = array("i", targets)
+        if len(sources) != len(targets):
+            raise ValueError("Sources and targets must have the same length")
+        if weights is not None:
+            weights = array("d", weights)
+            if len(weights) != len(sources):
+                raise ValueError("Weights must have the same length as sources")
+        created = array("i")
+        for i in range(len(sources)):
+            created.append(
+                self.create_edge(
+                    sources[i],
+                    targets[i],
+                    weight=weights[i] if weights is not None else None,
+                )
+            )
+        return created
+
     @abstractmethod
     def remove_edge(self, e):
         """Remove an edge from the graph.
@@ -285,6 +369,15 @@ class Graph(ABC):
         """
         pass
 
+    def remove_edges_from(self, edges):
+        """Remove many edges from the graph.
+
+        :param edges: an iterable or array of edge identifiers
+        :returns: the number of edges which were actually removed
+        :rtype: int
+        """
+        return sum(1 for e in array("i", edges) if self.remove_edge(e))
+
     @abstractmethod
     def contains_edge(self, e):
         """Check if an edge is contained in the graph.
@@ -427,6 +520,20 @@ class Graph(ABC):
         """
         pass
 
+    def set_edge_weights(self, edges, weights):
+        """Set the weights of many edges.
+
+        :param edges: an iterable or array of edges
+        :param weights: an iterable or array of weights, one per edge
+        :raises UnsupportedOperationError: in case the graph does not support weights
+        """
+        edges = array("i", edges)
+        weights = array("d", weights)
+        if len(edges) != len(weights):
+            raise ValueError("Edges and weights must have the same length")
+        for e, w in zip(edges, weights):
+            self.set_edge_weight(e, w)
+
     def number_of_vertices(self):
         """Get the number of vertices in the graph."""
         return len(self.vertices())
@@ -445,6 +552,45 @@ class Graph(ABC):
         """Graph edge set."""
         pass
 
+    def vertices_as_array(self):
+        """Get all vertices of the graph as an array of integers. This is much faster 
+        than iterating over :py:meth:`vertices` for large graphs.
+
+        :returns: the vertices in iteration order
+        :rtype: :py:class:`array.array`
+        """
+        return array("i", self.vertices())
+
+    def edges_as_array(self):
+        """Get all edges of the graph as an array of integers. This is much faster 
+        than iterating over :py:meth:`edges` for large graphs.
+
+        :returns: the edges in iteration order
+        :rtype: :py:class:`array.array`
+        """
+        return array("i", self.edges())
+
+    def edge_tuples_as_arrays(self, edges=None):
+        """Get the endpoints and weights of many edges as parallel arrays. This is 
+        the bulk version of :py:meth:`edge_tuple`.
+
+        :param edges: an iterable or array of edges. If None all edges of the graph are used
+        :returns: a tuple (edges, sources, targets, weights) of arrays with equal length 
+          where position i describes edge edges[i]. If the graph is unweighted the
+          weights are always 1.0
+        :rtype: tuple of :py:class:`array.array`
+        """
+        edges = self.edges_as_array() if edges is None else array("i", edges)
+        sources = array("i")
+        targets = array("i")
+        weights = array("d")
+        for e in edges:
+            u, v, w = self.edge_tuple(e)
+            sources.append(u)
+            targets.append(v)
+            weights.append(w)
+        return edges, sources, targets, weights
+
     @abstractmethod
     def edges_between(self, u, v):
         """Returns all edges between vertices u and v.
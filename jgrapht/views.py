@@ -3,7 +3,8 @@ from ._internals._views import (
     _UnweightedGraphView,
     _UnmodifiableGraphView,
     _UndirectedGraphView,
-    _EdgeReversedGraphView
+    _EdgeReversedGraphView,
+    _WeightedGraphView,
 )
 
 def as_unweighted(graph):
@@ -44,3 +45,32 @@ def as_edgereversed(graph):
     :returns: a graph with reversed edges
     """
     return _EdgeReversedGraphView(graph)
+
+
+def as_weighted(graph, weights):
+    """Create a weighted view of a graph, where the weight of edge e is weights[e]. 
+    
+    The weights are copied once into the backend, thus the view is cheap to create 
+    and weights can be replaced using :py:meth:`set_weights` of the view without 
+    touching or copying the original graph. Changing the weight of an edge of the view 
+    only changes the view. The structure of the view is unmodifiable and follows the 
+    original graph.
+
+    .. note :: The view weights are used by everything which reads edge weights through 
+      the backend: :py:meth:`get_edge_weight` and :py:meth:`edge_tuples_as_arrays` of 
+      the view and the algorithms executed natively on a snapshot of the graph, such as 
+      the minimum spanning tree algorithms, point-to-point :py:meth:`dijkstra
+      <jgrapht.algorithms.shortestpaths.dijkstra>`, :py:meth:`dijkstra_between_pairs
+      <jgrapht.algorithms.shortestpaths.dijkstra_between_pairs>`, 
+      :py:meth:`distance_matrix <jgrapht.algorithms.shortestpaths.distance_matrix>` 
+      and the maximum flow :py:meth:`solver <jgrapht.algorithms.flow.solver>`. The other 
+      algorithms which read edge weights, such as Bellman-Ford, A*, Johnson, Floyd-Warshall, 
+      the k shortest paths, the flow, matching and tour algorithms and the scoring 
+      algorithms without parallelism, raise a :py:class:`ValueError` on the view.
+
+    :param graph: the original graph
+    :param weights: array of doubles indexed by edge id, with an entry for every edge 
+      of the graph
+    :returns: a weighted graph
+    """
+    return _WeightedGraphView(graph, weights)
@@ -3,6 +3,7 @@ if sys.version_info < (3, 6):
     raise Exception('Building python-jgrapht requires Python 3.6 or higher.')
 import os
 import codecs
+import subprocess
 
 import setuptools
 from setuptools import setup
@@ -86,10 +87,68 @@ class CustomBuildExt(build_ext):
         super().run()
 
 
-_backend_extension = Extension('jgrapht._backend', ['jgrapht/backend.i','jgrapht/backend.c'],
+class BenchCommand(Command):
+    """A custom command to build the package and run the benchmark suite against it."""
+
+    description = 'run the benchmarks in benchmarks/'
+
+    user_options = [('scale=', None, 'comma separated scales, small, medium or large'),
+                    ('filter=', None, 'comma separated glob patterns on benchmark names'),
+                    ('repeat=', None, 'timed runs per benchmark'),
+                    ('output=', None, 'file to write the JSON report to'),
+                    ('baseline=', None, 'JSON report to compare with'),
+                    ('threshold=', None, 'slowdown factor reported as regression'),
+                    ]
+
+    def initialize_options(self):
+        self.scale = None
+        self.filter = None
+        self.repeat = None
+        self.output = None
+        self.baseline = None
+        self.threshold = None
+
+    def finalize_options(self):
+        pass
+
+    def run(self):
+        # the full build, since build_py copies the package and the SWIG generated
+        # backend.py next to the extension
+        self.run_command('build')
+        args = [sys.executable, os.path.join('benchmarks', 'run.py')]
+        for scale in (self.scale or '').split(','):
+            if scale:
+                args += ['--scale', scale]
+        for pattern in (self.filter or '').split(','):
+            if pattern:
+                args += ['--filter', pattern]
+        for option in ['repeat', 'output', 'baseline', 'threshold']:
+            value = getattr(self, option)
+            if value is not None:
+                args += ['--' + option, str(value)]
+        # the benchmarks import jgrapht from the build directory
+        build_lib = self.get_finalized_command('build').build_lib
+        env = dict(os.environ)
+        env['PYTHONPATH'] = os.pathsep.join(filter(None, [os.path.abspath(build_lib), env.get('PYTHONPATH')]))
+        status = subprocess.call(args, env=env)
+        if status != 0:
+            raise SystemExit(status)
+
+
+_backend_extension = Extension('jgrapht._backend', ['jgrapht/backend.i','jgrapht/backend.c',
+                                'jgrapht/backend_csr.c','jgrapht/backend_scoring.c',
+                                'jgrapht/backend_sp.c','jgrapht/backend_io.c',
+                                'jgrapht/backend_enum.c','jgrapht/backend_traverse.c',
+                                'jgrapht/backend_labels.c',
+                                'jgrapht/backend_metrics.c',
+                                'jgrapht/backend_flow.c',
+                                'jgrapht/backend_views.c',
+                                'jgrapht/backend_spanning.c',
+                                'jgrapht/backend_stats.c',
+                                'jgrapht/backend_pool.c'],
                                include_dirs=['jgrapht/', 'vendor/build/jgrapht-capi/', 'vendor/build/jgrapht-capi/src/main/native'],
                                library_dirs=['vendor/build/jgrapht-capi/'],
-                               libraries=['jgrapht_capi'],
+                               libraries=['jgrapht_capi', 'pthread'],
                                # Make sure that _backend.so will be able to load jgrapht_capi.so
                                runtime_library_dirs=['$ORIGIN'],
                                )
@@ -116,6 +175,7 @@ setup(
         'build_capi': BuildCapiCommand,
         'build_ext': CustomBuildExt,
         'build': CustomBuild,
+        'bench': BenchCommand,
     },
     ext_modules=[_backend_extension],
     version=get_version('jgrapht/__version__.py'),
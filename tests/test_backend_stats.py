@@ -0,0 +1,75 @@
+import gc
+import pytest
+
+import jgrapht
+from jgrapht import create_graph
+from array import array
+
+
+@pytest.fixture
+def stats():
+    jgrapht.enable_backend_stats()
+    jgrapht.backend_stats(reset=True)
+    yield
+    jgrapht.enable_backend_stats(False)
+
+
+def test_backend_stats_calls(stats):
+    g = create_graph(directed=False)
+    for _ in range(10):
+        g.create_vertex()
+    g.create_edge(0, 1)
+    with pytest.raises(ValueError):
+        g.create_edge(0, 100)
+
+    s = jgrapht.backend_stats()
+    assert s["enabled"]
+    add_vertex = s["calls"]["jgrapht_graph_add_vertex"]
+    assert add_vertex["calls"] == 10
+    assert add_vertex["errors"] == 0
+    assert add_vertex["time"] >= 0.0
+    add_edge = s["calls"]["jgrapht_graph_add_edge"]
+    assert add_edge["calls"] == 2
+    assert add_edge["errors"] == 1
+    assert "jgrapht_stats_entry" not in s["calls"]
+
+    s = jgrapht.backend_stats(reset=True)
+    assert "jgrapht_graph_add_vertex" in s["calls"]
+    s = jgrapht.backend_stats()
+    assert "jgrapht_graph_add_vertex" not in s["calls"]
+
+
+def test_backend_stats_bytes(stats):
+    g = create_graph(directed=True)
+    g.create_vertices(4)
+    g.create_edges_from_arrays(array("i", [0, 1, 2]), array("i", [1, 2, 3]))
+
+    s = jgrapht.backend_stats()
+    add_edges = s["calls"]["jgrapht_graph_add_edges"]
+    # sources, targets and the edges written back
+    assert add_edges["bytes"] >= 2 * 3 * array("i").itemsize
+
+
+def test_backend_stats_disabled():
+    jgrapht.enable_backend_stats(False)
+    jgrapht.backend_stats(reset=True)
+    g = create_graph(directed=False)
+    g.create_vertex()
+
+    s = jgrapht.backend_stats()
+    assert not s["enabled"]
+    assert s["calls"] == {}
+
+
+def test_backend_stats_live_handles():
+    gc.collect()
+    live = jgrapht.backend_stats()["handles"]["live"]
+
+    graphs = [create_graph(directed=False) for _ in range(3)]
+    handles = jgrapht.backend_stats()["handles"]
+    assert handles["live"] == live + 3
+    assert handles["created"] - handles["destroyed"] == handles["live"]
+
+    del graphs
+    gc.collect()
+    assert jgrapht.backend_stats()["handles"]["live"] == live
@@ -55,4 +55,44 @@ def test_bron():
     assert set(next(clique_it)) == set([3, 4, 5])
 
     with pytest.raises(StopIteration):
-        next(clique_it)
\ No newline at end of file
+        next(clique_it)
+
+def test_bron_batches():
+    g = build_graph()
+
+    found = []
+    for members, offsets in cliques.bron_kerbosch_batches(g, batch_size=2):
+        assert len(offsets) <= 3
+        for i in range(len(offsets) - 1):
+            found.append(frozenset(members[offsets[i]:offsets[i+1]]))
+
+    assert set(found) == set([frozenset([0, 1, 2]), frozenset([2, 3]), frozenset([3, 4, 5])])
+    assert len(found) == 3
+
+    batches = list(cliques.bron_kerbosch_batches(g, min_size=3))
+    assert len(batches) == 1
+    members, offsets = batches[0]
+    assert list(offsets) == [0, 3, 6]
+    assert set(members) == set([0, 1, 2, 3, 4, 5])
+
+    batches = list(cliques.bron_kerbosch_batches(g, max_results=1))
+    assert len(batches) == 1
+    assert len(batches[0][1]) == 2
+
+
+def test_bron_batches_parallel():
+    g = build_graph()
+
+    for threads in [2, 4, 0]:
+        found = []
+        for members, offsets in cliques.bron_kerbosch_batches(g, batch_size=1, threads=threads):
+            assert len(offsets) == 2
+            found.append(frozenset(members))
+        assert len(found) == 3
+        assert set(found) == set([frozenset([0, 1, 2]), frozenset([2, 3]), frozenset([3, 4, 5])])
+
+    batches = list(cliques.bron_kerbosch_batches(g, min_size=3, threads=3, timeout=10))
+    assert sum(len(offsets) - 1 for _, offsets in batches) == 2
+
+    batches = list(cliques.bron_kerbosch_batches(g, max_results=2, threads=2))
+    assert sum(len(offsets) - 1 for _, offsets in batches) == 2
@@ -1,6 +1,6 @@
 import pytest
 
-from jgrapht import create_graph
+from jgrapht import create_graph, create_sparse_graph
 import jgrapht.algorithms.clustering as clustering
 
 def test_k_spanning_tree():
@@ -50,3 +50,42 @@ def test_label_propagation():
     assert c.number_of_clusters() == 2
     assert set(c.ith_cluster(0)) == set([0,1,2])
     assert set(c.ith_cluster(1)) == set([3,4,5])
+
+
+def test_label_propagation_parallel():
+    g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+
+    g.add_vertices_from(range(40))
+    for offset in [0, 20]:
+        for i in range(20):
+            for j in range(i + 1, 20):
+                g.create_edge(offset + i, offset + j)
+    g.create_edge(0, 20)
+    g.add_vertex(40)
+
+    for threads in [1, 4]:
+        c = clustering.label_propagation(g, seed=17, threads=threads)
+        assert c.number_of_clusters() == 3
+        assert set(c.ith_cluster(0)) == set(range(20))
+        assert set(c.ith_cluster(1)) == set(range(20, 40))
+        assert set(c.ith_cluster(2)) == set([40])
+        assert list(c.labels) == [0] * 20 + [1] * 20 + [2]
+
+    c = clustering.label_propagation(g, max_iterations=1, seed=17, threads=1)
+    assert len(c.labels) == 41
+
+
+def test_label_propagation_parallel_chunks():
+    # vertex v belongs to clique v % 8, thus every chunk of vertices mixes all cliques
+    cliques = 8
+    n = 800
+    edges = []
+    for u in range(n):
+        for v in range(u + cliques, n, cliques):
+            edges.append((u, v))
+    g = create_sparse_graph(n + 1, edges, directed=False, weighted=False)
+
+    for threads in [1, 4, 0]:
+        c = clustering.label_propagation(g, seed=17, threads=threads)
+        assert c.number_of_clusters() == cliques + 1
+        assert list(c.labels) == [v % cliques for v in range(n)] + [cliques]
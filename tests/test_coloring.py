@@ -57,3 +57,19 @@ def test_coloring():
 
     color_count, color_map = coloring.color_refinement(g)
     assert color_count == 10
+
+
+def test_coloring_to_arrays():
+    g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    g.add_vertices_from(range(4))
+    g.create_edge(0, 1)
+    g.create_edge(1, 2)
+    g.create_edge(2, 0)
+    g.create_edge(2, 3)
+
+    _, color_map = coloring.greedy_smallestnotusedcolor(g)
+
+    colored, colors = color_map.to_arrays()
+    assert len(colored) == len(colors) == 4
+    assert dict(zip(colored, colors)) == {v: color_map[v] for v in g.vertices()}
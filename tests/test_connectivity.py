@@ -66,6 +66,34 @@ def test_weakly_directed():
     assert component2 == set([4, 5])
 
 
+def test_weakly_parallel():
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    g.add_vertices_from([5, 1, 2, 3, 4, 0, 6])
+    g.create_edge(1, 2)
+    g.create_edge(3, 2)
+    g.create_edge(0, 4)
+    g.create_edge(4, 5)
+
+    for threads in [1, 4, 0]:
+        components = connectivity.weakly_connected_components(g, threads=threads)
+        assert components.number_of_clusters() == 3
+        assert list(components.vertices) == [5, 1, 2, 3, 4, 0, 6]
+        assert list(components.labels) == [0, 1, 1, 1, 0, 0, 2]
+        assert set(components.ith_cluster(0)) == set([0, 4, 5])
+        assert set(components.ith_cluster(2)) == set([6])
+
+    is_connected, components = connectivity.is_weakly_connected(g, threads=2)
+    assert not is_connected
+    assert list(components) == [set([0, 4, 5]), set([1, 2, 3]), set([6])]
+
+    g.create_edge(6, 1)
+    g.create_edge(3, 0)
+    is_connected, components = connectivity.is_weakly_connected(g, threads=2)
+    assert is_connected
+    assert list(components) == [set([0, 1, 2, 3, 4, 5, 6])]
+
+
 def test_strongly_kosaraju():
     g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
 
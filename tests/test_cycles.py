@@ -229,3 +229,46 @@ def test_simple_cycles_hawick_james():
         next(it)
 
 
+
+
+def test_simple_cycles_batches():
+
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    g.add_vertices_from([0,1,2,3,4,5])
+
+    g.create_edge(0, 1)
+    g.create_edge(1, 2)
+    g.create_edge(2, 3)
+    g.create_edge(3, 0)
+    g.create_edge(1, 4)
+    g.create_edge(4, 5)
+    g.create_edge(5, 2)
+
+    it = cycles.enumerate_simple_cycles_batches(g, batch_size=1)
+
+    members, offsets = next(it)
+    assert list(members) == [0, 1, 2, 3]
+    assert list(offsets) == [0, 4]
+    members, offsets = next(it)
+    assert list(members) == [0, 1, 4, 5, 2, 3]
+    assert list(offsets) == [0, 6]
+
+    with pytest.raises(StopIteration):
+        next(it)
+
+    batches = list(cycles.enumerate_simple_cycles_batches(g))
+    assert len(batches) == 1
+    assert list(batches[0][1]) == [0, 4, 10]
+
+    batches = list(cycles.enumerate_simple_cycles_batches(g, min_size=5))
+    assert len(batches) == 1
+    assert list(batches[0][0]) == [0, 1, 4, 5, 2, 3]
+
+    batches = list(cycles.enumerate_simple_cycles_batches(g, max_results=1))
+    assert len(batches) == 1
+    assert list(batches[0][0]) == [0, 1, 2, 3]
+
+    ug = create_graph(directed=False)
+    with pytest.raises(ValueError):
+        cycles.enumerate_simple_cycles_batches(ug)
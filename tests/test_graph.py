@@ -1,6 +1,7 @@
 import pytest
 
-from jgrapht import create_graph, create_sparse_graph, as_sparse_graph
+from jgrapht import create_graph, create_sparse_graph, create_sparse_graph_from_arrays, as_sparse_graph, as_csr_graph
+from array import array
 
 
 def assert_same_set(set1, set2):
@@ -398,3 +399,203 @@ def test_graph_copy_to_sparse():
     assert len(gs.edges()) == 3
     assert gs.type.weighted
     assert gs.type.directed
+
+
+def test_graph_copy_to_csr():
+
+    g = create_graph(directed=False, allowing_self_loops=True, allowing_multiple_edges=True, weighted=True)
+
+    g.add_vertices_from([10, 20, 30, 40])
+    g.add_edge(10, 30, 100, weight=1.5)
+    g.add_edge(10, 20, 101, weight=2.5)
+    g.add_edge(20, 30, 102)
+    g.add_edge(30, 40, 103, weight=4.5)
+    g.add_edge(40, 40, 104)
+
+    gs = as_csr_graph(g)
+
+    # the isolate copy is built on first use
+    assert gs.number_of_edges() == 5
+    assert list(gs.neighbors(1)) == [0, 2]
+    assert gs._sparse_handle is None
+
+    assert gs.type.weighted
+    assert not gs.type.directed
+    assert list(gs.original_vertices) == [10, 20, 30, 40]
+    assert gs.vertices() == set(range(4))
+    assert len(gs.edges()) == 5
+    assert list(gs.offsets) == [0, 2, 4, 7, 9]
+
+    assert list(gs.neighbors(0)) == [1, 2]
+    assert list(gs.neighbors(2)) == [0, 1, 3]
+    assert list(gs.neighbors(3)) == [2, 3]
+    assert list(gs.neighbor_weights(0)) == [2.5, 1.5]
+
+    # edges of the copy match those of the original graph
+    for e in gs.edges():
+        u, v, w = gs.edge_tuple(e)
+        original = gs.original_edges[e]
+        assert g.get_edge_weight(original) == w
+        assert {gs.original_vertices[u], gs.original_vertices[v]} == {
+            g.edge_source(original),
+            g.edge_target(original),
+        }
+    for v in gs.vertices():
+        assert set(gs.neighbor_edges(v)) == set(gs.edges_of(v))
+
+    with pytest.raises(IndexError):
+        gs.neighbors(4)
+    with pytest.raises(ValueError):
+        gs.create_edge(0, 1)
+
+
+def test_graph_copy_to_csr_sorted_by_degree():
+
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+
+    g.add_vertices_from(range(5))
+    for v in range(1, 5):
+        g.create_edge(v, 0)
+    g.create_edge(1, 2)
+    g.create_edge(3, 2)
+    g.create_edge(4, 2)
+
+    gs = as_csr_graph(g, sort_by_degree=True)
+
+    assert gs.weights is None
+    assert gs.type.directed
+    assert list(gs.original_vertices) == [0, 2, 1, 3, 4]
+    assert list(gs.neighbors(2)) == [0, 1]
+    assert list(gs.neighbors(0)) == []
+    assert len(gs.targets) == 7
+
+    for e in gs.edges():
+        u, v, _ = gs.edge_tuple(e)
+        original = gs.original_edges[e]
+        assert gs.original_vertices[u] == g.edge_source(original)
+        assert gs.original_vertices[v] == g.edge_target(original)
+
+    with pytest.raises(ValueError):
+        gs.neighbor_weights(0)
+
+
+def test_graph_bulk_arrays():
+
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    for i in range(0, 5):
+        g.add_vertex(i)
+
+    g.create_edge(0, 1, weight=1.5)
+    g.create_edge(1, 2, weight=2.5)
+    g.create_edge(2, 3)
+    g.create_edge(3, 4, weight=4.5)
+
+    assert list(g.vertices_as_array()) == list(g.vertices())
+    assert list(g.edges_as_array()) == list(g.edges())
+
+    edges, sources, targets, weights = g.edge_tuples_as_arrays()
+    assert list(edges) == [0, 1, 2, 3]
+    assert list(sources) == [0, 1, 2, 3]
+    assert list(targets) == [1, 2, 3, 4]
+    assert list(weights) == [1.5, 2.5, 1.0, 4.5]
+
+    edges, sources, targets, weights = g.edge_tuples_as_arrays([3, 1])
+    assert list(zip(sources, targets, weights)) == [(3, 4, 4.5), (1, 2, 2.5)]
+
+    with pytest.raises(ValueError):
+        g.edge_tuples_as_arrays([10])
+
+    it = g.edges_of(2)
+    first = it.next_array(1)
+    assert len(first) == 1
+    rest = it.next_array(10)
+    assert len(rest) == 1
+    assert set(first) | set(rest) == set([1, 2])
+    assert len(it.next_array(10)) == 0
+
+
+def test_sparse_graph_from_arrays():
+
+    sources = array("i", [0, 0, 1, 2, 3])
+    targets = array("i", [1, 2, 3, 3, 4])
+    weights = array("d", [1.0, 2.0, 3.0, 4.0, 5.0])
+
+    g = create_sparse_graph_from_arrays(5, sources, targets, weights, directed=True, weighted=True)
+
+    assert g.type.directed
+    assert g.type.weighted
+    assert len(g.vertices()) == 5
+    assert len(g.edges()) == 5
+    assert [g.edge_tuple(e) for e in g.edges()] == list(zip(sources, targets, weights))
+
+    # plain lists are converted
+    g = create_sparse_graph_from_arrays(5, [0, 1], [1, 2], directed=False, weighted=False)
+    assert not g.type.directed
+    assert not g.type.weighted
+    assert len(g.edges()) == 2
+    assert g.edge_tuple(1) == (1, 2, 1.0)
+
+    with pytest.raises(ValueError):
+        create_sparse_graph_from_arrays(5, [0, 1], [1])
+
+    with pytest.raises(TypeError):
+        create_sparse_graph_from_arrays(5, array("d", [0.0]), [1])
+
+
+def test_graph_bulk_mutation():
+
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    assert list(g.create_vertices(3)) == [0, 1, 2]
+    assert g.add_vertices_from([2, 3, 4]) == [False, True, True]
+    assert len(g.vertices()) == 5
+
+    edges = g.create_edges_from_arrays([0, 1, 2], [1, 2, 3])
+    assert list(edges) == [0, 1, 2]
+    assert [g.edge_tuple(e) for e in edges] == [(0, 1, 1.0), (1, 2, 1.0), (2, 3, 1.0)]
+
+    edges = g.create_edges_from_arrays(array("i", [3]), array("i", [4]), array("d", [5.5]))
+    assert list(edges) == [3]
+    assert g.edge_tuple(3) == (3, 4, 5.5)
+
+    assert g.create_edges_from([(0, 2, 2.0), (0, 3, 3.0)]) == [4, 5]
+    assert g.create_edges_from([(0, 4), (1, 3, 7.0)]) == [6, 7]
+    assert g.get_edge_weight(6) == 1.0
+    assert g.get_edge_weight(7) == 7.0
+
+    g.set_edge_weights([0, 1], [10.0, 20.0])
+    assert g.get_edge_weight(0) == 10.0
+    assert g.get_edge_weight(1) == 20.0
+
+    with pytest.raises(ValueError):
+        g.set_edge_weights([0, 1], [1.0])
+
+    with pytest.raises(ValueError):
+        g.create_edges_from_arrays([0, 1], [2])
+
+    assert g.remove_edges_from([0, 1, 100]) == 2
+    assert len(g.edges()) == 6
+
+    ug = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+    ug.create_vertices(2)
+    with pytest.raises(ValueError):
+        ug.create_edges_from_arrays([0], [0])
+
+
+def test_graph_create_edges_from_none_weights():
+
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+    g.create_vertices(4)
+
+    assert g.create_edges_from([(0, 1, None), (1, 2, None)]) == [0, 1]
+    assert g.get_edge_weight(0) == 1.0
+    assert g.get_edge_weight(1) == 1.0
+
+    assert g.create_edges_from([(2, 3, None), (3, 0, 4.0)]) == [2, 3]
+    assert g.get_edge_weight(2) == 1.0
+    assert g.get_edge_weight(3) == 4.0
+
+    ug = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+    ug.create_vertices(3)
+    assert ug.create_edges_from([(0, 1, None), (1, 2, None)]) == [0, 1]
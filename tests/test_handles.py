@@ -0,0 +1,93 @@
+import gc
+import pytest
+
+import jgrapht
+from jgrapht import create_graph
+
+
+def build_graph():
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False)
+    g.create_vertices(5)
+    g.create_edge(0, 1)
+    g.create_edge(0, 2)
+    g.create_edge(1, 2)
+    g.create_edge(3, 0)
+    return g
+
+
+def live_handles():
+    gc.collect()
+    return jgrapht.backend_stats()["handles"]["live"]
+
+
+def test_handle_arena():
+    g = build_graph()
+    live = live_handles()
+
+    with jgrapht.handle_arena() as arena:
+        # the iterator over the vertices joins the arena as well
+        iterators = [g.edges_of(v) for v in g.vertices()]
+        assert len(arena) == 6
+        assert [len(list(it)) for it in iterators] == [3, 2, 2, 1, 0]
+        kept = arena.detach(g.outedges_of(0))
+        assert len(arena) == 6
+    assert len(arena) == 0
+    for it in iterators:
+        assert it.handle is None
+    del iterators
+    assert live_handles() == live + 1
+
+    assert set(kept) == {0, 1}
+    del kept
+    assert live_handles() == live
+
+
+def test_handle_arena_clear_and_nesting():
+    g = build_graph()
+    live = live_handles()
+
+    with jgrapht.handle_arena() as outer:
+        g.edges_of(0)
+        with jgrapht.handle_arena() as inner:
+            g.edges_of(1)
+            g.edges_of(2)
+            assert len(inner) == 2
+            inner.clear()
+            assert len(inner) == 0
+        assert len(outer) == 1
+
+    # objects created outside of any arena are destroyed on their own
+    it = g.edges_of(0)
+    assert it.handle is not None
+    del it
+    assert live_handles() == live
+
+
+def test_pooled_iterator():
+    g = build_graph()
+    it = jgrapht.pooled_iterator(chunk_size=2)
+    assert list(it) == []
+
+    assert list(it.reset(g)) == [0, 1, 2, 3, 4]
+    assert list(it.reset(g, "edges")) == [0, 1, 2, 3]
+    assert set(it.reset(g, "edges_of", 0)) == {0, 1, 3}
+    assert set(it.reset(g, "outedges_of", 0)) == {0, 1}
+    assert set(it.reset(g, "inedges_of", 2)) == {1, 2}
+
+    live = live_handles()
+    total = 0
+    for v in g.vertices():
+        total += sum(1 for _ in it.reset(g, "outedges_of", v))
+    assert total == 4
+    assert live_handles() == live
+
+    with pytest.raises(ValueError):
+        it.reset(g, "paths")
+    with pytest.raises(ValueError):
+        it.reset(g, "edges_of")
+    with pytest.raises(ValueError):
+        it.reset(g, "edges_of", 100)
+    assert list(it) == []
+
+    with pytest.raises(ValueError):
+        jgrapht.pooled_iterator(chunk_size=0)
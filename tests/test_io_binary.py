@@ -0,0 +1,90 @@
+import io
+
+import pytest
+
+from jgrapht import create_graph, create_sparse_graph
+from jgrapht.io.exporters import write_binary
+from jgrapht.io.importers import read_binary
+
+
+def test_binary_directed(tmpdir):
+    g = create_graph(directed=True, allowing_self_loops=True, allowing_multiple_edges=True, weighted=True)
+
+    g.add_vertices_from([0, 1, 2, 5])
+    g.create_edge(5, 0, weight=1.5)
+    g.create_edge(0, 1, weight=2.0)
+    g.create_edge(0, 2, weight=3.0)
+    g.create_edge(2, 2, weight=4.0)
+    g.create_edge(1, 2, weight=5.0)
+    g.create_edge(1, 2, weight=6.0)
+
+    tmpfile = tmpdir.join('graph.bin')
+    tmpfilename = str(tmpfile)
+
+    write_binary(g, tmpfilename)
+
+    g1 = read_binary(tmpfilename)
+
+    assert g1.type.directed
+    assert g1.type.weighted
+    assert len(g1.vertices()) == 6
+    assert len(g1.edges()) == 6
+
+    # edge identifiers 0 up to 5 are kept
+    for e in g.edges():
+        assert g1.edge_tuple(e) == g.edge_tuple(e)
+
+    assert g1.outdegree_of(3) == 0
+    assert g1.indegree_of(2) == 4
+
+
+def test_binary_undirected_roundtrip(tmpdir):
+    g = create_sparse_graph(4, [(0, 1), (1, 2), (2, 3), (3, 0), (0, 2)], directed=False, weighted=False)
+
+    tmpfile = tmpdir.join('graph.bin')
+    tmpfilename = str(tmpfile)
+
+    write_binary(g, tmpfilename)
+    g1 = read_binary(tmpfilename)
+
+    assert not g1.type.directed
+    assert not g1.type.weighted
+    assert len(g1.vertices()) == 4
+    assert len(g1.edges()) == 5
+    for e in g.edges():
+        assert g1.edge_tuple(e) == g.edge_tuple(e)
+    assert g1.degree_of(0) == 3
+
+
+def test_binary_invalid_file(tmpdir):
+    tmpfile = tmpdir.join('graph.bin')
+    tmpfile.write('this is not a graph')
+
+    with pytest.raises(IOError):
+        read_binary(str(tmpfile))
+
+    with pytest.raises(IOError):
+        read_binary(str(tmpdir.join('missing.bin')))
+
+
+def test_binary_to_file_like(tmpdir):
+    g = create_sparse_graph(4, [(0, 1), (1, 2), (2, 3), (3, 0)], directed=True, weighted=False)
+
+    tmpfile = tmpdir.join('graph.bin')
+    tmpfilename = str(tmpfile)
+    write_binary(g, tmpfilename)
+    expected = tmpfile.read_binary()
+
+    out = io.BytesIO()
+    assert write_binary(g, out) == len(expected)
+    assert out.getvalue() == expected
+
+    buffer = bytearray(len(expected))
+    assert write_binary(g, buffer) == len(expected)
+    assert bytes(buffer) == expected
+
+    with pytest.raises(ValueError):
+        write_binary(g, bytearray(8))
+
+    with pytest.raises(TypeError):
+        write_binary(g, io.StringIO())
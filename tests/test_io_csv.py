@@ -97,3 +97,48 @@ def test_output_to_string():
     out = generate_csv(g)
 
     assert out.splitlines() == ['0,1,2,3', '1', '2,3', '3']
+
+
+def test_output_edgelist_parallel(tmpdir):
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=True, weighted=True)
+
+    g.add_vertices_from(range(0, 100))
+    for i in range(0, 100):
+        g.create_edge(i, (i + 1) % 100, weight=i / 4)
+        g.create_edge(i, (i + 7) % 100, weight=1e7 * i)
+
+    expected_file = str(tmpdir.join('expected.csv'))
+    write_csv(g, expected_file, format="edgelist", export_edge_weights=True)
+
+    tmpfilename = str(tmpdir.join('parallel.csv'))
+    write_csv(g, tmpfilename, format="edgelist", export_edge_weights=True, threads=4)
+
+    with open(expected_file, "r") as f:
+        expected = f.read()
+    with open(tmpfilename, "r") as f:
+        contents = f.read()
+
+    assert contents.splitlines() == expected.splitlines()
+
+
+@pytest.mark.parametrize("weighted", [True, False])
+def test_output_edgelist_parallel_weights(tmpdir, weighted):
+    g = create_graph(directed=False, allowing_self_loops=True, allowing_multiple_edges=True, weighted=weighted)
+
+    g.add_vertices_from(range(0, 50))
+    for i in range(0, 50):
+        if weighted:
+            g.create_edge(i, (i * 3) % 50, weight=0.1 * i - 2.0)
+        else:
+            g.create_edge(i, (i * 3) % 50)
+
+    expected_file = str(tmpdir.join('expected.csv'))
+    write_csv(g, expected_file, format="edgelist", export_edge_weights=True)
+    with open(expected_file, "rb") as f:
+        expected = f.read()
+
+    for threads in [1, 3]:
+        tmpfilename = str(tmpdir.join('parallel.csv'))
+        write_csv(g, tmpfilename, format="edgelist", export_edge_weights=True, threads=threads)
+        with open(tmpfilename, "rb") as f:
+            assert f.read() == expected
@@ -66,3 +66,20 @@ def test_output_to_string():
 
     assert out.splitlines() == 'digraph G {\n  0;\n  1;\n  2;\n  3;\n  0 -> 1;\n  0 -> 2;\n  0 -> 3;\n  2 -> 3;\n}\n'.splitlines()
 
+
+
+def test_output_attributes_to_string():
+    g = build_graph()
+
+    v_dict = {
+        0: { 'color': 'red', 'size': 3 },
+        1: { 'color': 'blue' },
+        2: { 'size': 5 },
+    }
+
+    out = generate_dot(g, per_vertex_attrs_dict=v_dict)
+
+    assert 'color="red"' in out
+    assert 'color="blue"' in out
+    assert 'size="3"' in out
+    assert 'size="5"' in out
@@ -0,0 +1,73 @@
+import pytest
+import io
+
+from jgrapht.io.importers import create_edgelist_importer, read_edgelist_stream
+
+
+def test_push_blocks():
+    importer = create_edgelist_importer(directed=True, weighted=True)
+
+    importer.push(b"# comment\n0,1,1.5\n1,")
+    importer.push("2,2.5\n\n2,0")
+    importer.push(b"\n3 , 4 , 4.0\n4,0")
+
+    g = importer.finish()
+
+    assert g.type.directed
+    assert g.type.weighted
+    assert len(g.vertices()) == 5
+    assert len(g.edges()) == 5
+    assert g.edge_tuple(0) == (0, 1, 1.5)
+    assert g.edge_tuple(1) == (1, 2, 2.5)
+    assert g.edge_tuple(2) == (2, 0, 1.0)
+    assert g.edge_tuple(3) == (3, 4, 4.0)
+    assert g.edge_tuple(4) == (4, 0, 1.0)
+
+    with pytest.raises(ValueError):
+        importer.push(b"1,2\n")
+
+
+def test_read_stream_whitespace():
+    source = io.BytesIO(b"0 1\n1\t2\n2 3\n")
+
+    g = read_edgelist_stream(source, directed=False, delimiter=" ", num_vertices=6, block_size=3)
+
+    assert not g.type.directed
+    assert len(g.vertices()) == 6
+    assert len(g.edges()) == 3
+    assert g.degree_of(1) == 2
+
+
+def test_read_stream_with_callback():
+    source = io.StringIO("a,b\nb,c\nc,a\n")
+
+    def import_id_cb(id):
+        return {"a": 0, "b": 1, "c": 2}[id]
+
+    g = read_edgelist_stream(source, import_id_cb=import_id_cb, block_size=4)
+
+    assert len(g.vertices()) == 3
+    assert g.edge_tuple(2) == (2, 0, 1.0)
+
+
+def test_invalid_input():
+    importer = create_edgelist_importer()
+    importer.push(b"0,1\n")
+    with pytest.raises(IOError):
+        importer.push(b"0,x\n")
+
+
+def test_callback_truncated_utf8():
+    def import_id_cb(id):
+        return {"a": 0, "κ": 1}[id]
+
+    importer = create_edgelist_importer(import_id_cb=import_id_cb)
+    data = "a,κ\nκ,a".encode("utf-8")
+    importer.push(data)
+    g = importer.finish()
+    assert g.edge_tuple(1) == (1, 0, 1.0)
+
+    importer = create_edgelist_importer(import_id_cb=import_id_cb)
+    importer.push("a,κ".encode("utf-8")[:-1])
+    with pytest.raises(IOError):
+        importer.finish()
@@ -2,7 +2,7 @@ import pytest
 
 from jgrapht import create_graph
 from jgrapht.io.exporters import write_gml, generate_gml
-from jgrapht.io.importers import read_gml, parse_gml
+from jgrapht.io.importers import read_gml, parse_gml, create_attribute_columns
 
 
 expected="""Creator "JGraphT GML Exporter"
@@ -307,6 +307,45 @@ def test_input_gml_from_string(tmpdir):
 	parse_gml(g, expected, vertex_attribute_cb=va_cb, edge_attribute_cb=ea_cb)
 
 
+def test_input_gml_attribute_columns():
+
+	g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+	vertex_columns = create_attribute_columns()
+	edge_columns = create_attribute_columns()
+
+	parse_gml(g, expected, vertex_attribute_cb=vertex_columns, edge_attribute_cb=edge_columns)
+
+	ids, labels = vertex_columns['label']
+	assert len(ids) == 10
+	assert dict(zip(ids, labels))[2] == 'κόμβος 2'
+	assert dict(zip(ids, labels))[5] == '5'
+
+	ids, labels = edge_columns['label']
+	assert dict(zip(ids, labels))[9] == 'ακμή 1-2'
+
+	with pytest.raises(KeyError):
+		vertex_columns['missing']
+
+
+def test_input_gml_typed_attribute_columns():
+
+	g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+	input_string ="Version 1 graph [ directed 0 node [ id 5 size 3 score 1.5 ] node [ id 7 size 4 score 2 ] edge [ source 5 target 7 ] ]"
+
+	vertex_columns = create_attribute_columns()
+	parse_gml(g, input_string, vertex_attribute_cb=vertex_columns)
+
+	ids, sizes = vertex_columns['size']
+	assert sizes.typecode == 'i'
+	assert dict(zip(ids, sizes)) == {5: 3, 7: 4}
+
+	ids, scores = vertex_columns['score']
+	assert scores.typecode == 'd'
+	assert dict(zip(ids, scores)) == {5: 1.5, 7: 2.0}
+
+
 def test_input_gml_nocallbacks(tmpdir):
 	tmpfile = tmpdir.join('gml.out')
 	tmpfilename = str(tmpfile)
@@ -1,4 +1,5 @@
 import pytest
+import io
 
 from jgrapht import create_graph
 from jgrapht.io.exporters import write_json, generate_json
@@ -129,3 +130,58 @@ def test_output_to_string():
 
     out = generate_json(g)
     assert out.splitlines() == expected2.splitlines()
+
+
+def test_output_json_parallel(tmpdir):
+    g = build_graph()
+    tmpfilename = str(tmpdir.join('json.out'))
+
+    write_json(g, tmpfilename, threads=3)
+
+    with open(tmpfilename, "r") as f: 
+        contents = f.read()
+
+    assert contents == generate_json(g)
+
+
+def test_output_json_parallel_weighted(tmpdir):
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=True, weighted=True)
+
+    g.add_vertices_from(range(0, 50))
+    for i in range(0, 50):
+        g.create_edge(i, (i + 1) % 50, weight=1.0 if i % 2 == 0 else i / 8)
+
+    expected_output = generate_json(g).encode('utf-8')
+
+    for threads in [1, 3]:
+        tmpfilename = str(tmpdir.join('json.out'))
+        write_json(g, tmpfilename, threads=threads)
+        with open(tmpfilename, "rb") as f:
+            assert f.read() == expected_output
+
+
+def test_output_json_to_sinks():
+    g = build_graph()
+    expected_output = generate_json(g).encode('utf-8')
+
+    out = io.BytesIO()
+    assert write_json(g, out) == len(expected_output)
+    assert out.getvalue() == expected_output
+
+    out = io.StringIO()
+    write_json(g, out, threads=2)
+    assert out.getvalue().encode('utf-8') == expected_output
+
+    buffer = bytearray(len(expected_output) + 10)
+    written = write_json(g, buffer, threads=2)
+    assert bytes(buffer[:written]) == expected_output
+
+    with pytest.raises(ValueError):
+        write_json(g, bytearray(10))
+
+
+def test_output_json_attribute_with_zero_character():
+    g = build_graph()
+
+    with pytest.raises(ValueError, match="one zero terminated string per element"):
+        generate_json(g, per_vertex_attrs_dict={0: {"label": "a\0b"}})
@@ -1,5 +1,7 @@
 import pytest
 
+from concurrent.futures import ThreadPoolExecutor
+
 from jgrapht import create_graph
 import jgrapht.algorithms.flow as flow
 
@@ -93,4 +95,83 @@ def test_min_st_cut():
     _do_run_cut(flow.min_st_cut)
 
 def test_max_st_flow():
-    _do_run_flow(flow.max_st_flow)    
\ No newline at end of file
+    _do_run_flow(flow.max_st_flow)    
+
+def test_solver():
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    g.add_vertices_from(range(4))
+
+    e01 = g.create_edge(0, 1, weight=20)
+    g.create_edge(0, 2, weight=10)
+    g.create_edge(1, 2, weight=30)
+    g.create_edge(1, 3, weight=10)
+    g.create_edge(2, 3, weight=20)
+
+    solver = flow.solver(g)
+
+    assert solver.max_flow_value(0, 3) == 30.0
+    assert list(solver.max_flow_values([0, 1, 0, 3], [3, 3, 2, 0], threads=2)) == [30.0, 30.0, 30.0, 0.0]
+
+    values, cuts = solver.max_flow_values([0, 1], [3, 3], cuts=True)
+    assert list(values) == [30.0, 30.0]
+    assert solver.source_partition(cuts, 0) == set([0])
+    # 1->2 carries 20 of 30, so 2 is still reachable in the residual network
+    assert solver.source_partition(cuts, 1) == set([1, 2])
+
+    solver.set_capacities([e01], [5.0])
+    values, cuts = solver.max_flow_values([0], [3], cuts=True)
+    assert values[0] == 15.0
+    assert solver.source_partition(cuts) == set([0])
+
+    with pytest.raises(ValueError):
+        solver.set_capacities([e01], [-1.0])
+    with pytest.raises(ValueError):
+        solver.set_capacities([100], [1.0])
+    with pytest.raises(ValueError):
+        solver.max_flow_value(0, 0)
+    with pytest.raises(ValueError):
+        solver.max_flow_value(0, 10)
+
+
+def test_solver_undirected():
+    g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    g.add_vertices_from(range(4))
+
+    g.create_edge(0, 1, weight=20)
+    g.create_edge(0, 2, weight=10)
+    g.create_edge(1, 2, weight=30)
+    g.create_edge(1, 3, weight=10)
+    g.create_edge(2, 3, weight=20)
+
+    solver = flow.solver(g)
+
+    for s, t in [(0, 3), (3, 0), (1, 2)]:
+        f, _ = flow.dinic(g, s, t)
+        assert solver.max_flow_value(s, t) == f.value
+
+
+def test_solver_concurrent_batches():
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    n = 200
+    g.add_vertices_from(range(n))
+    for i in range(n):
+        for d in [1, 2, 3]:
+            g.create_edge(i, (i + d) % n, weight=d)
+
+    solver = flow.solver(g)
+
+    sources = list(range(n))
+    sinks = [(i + n // 2) % n for i in range(n)]
+    expected = list(solver.max_flow_values(sources, sinks))
+
+    def batch(threads):
+        return list(solver.max_flow_values(sources, sinks, threads=threads))
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(batch, [1, 2, 3, 4] * 4))
+
+    for values in results:
+        assert values == expected
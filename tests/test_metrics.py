@@ -1,6 +1,8 @@
 import pytest
 
 from jgrapht import create_graph
+from jgrapht.views import as_unweighted
+import jgrapht.generators as generators
 import jgrapht.metrics as metrics
 
 def create_test_graph():
@@ -63,3 +65,85 @@ def test_measure():
     for i in range(1,10): 
         assert eccentricity_map[i] == 2.0
 
+
+def test_count_triangles_parallel():
+    g = create_test_graph()
+    assert metrics.count_triangles(g, threads=1) == 9
+    assert metrics.count_triangles(g, threads=4) == 9
+
+    # self-loops and multiple edges are ignored
+    g = create_graph(directed=False, allowing_self_loops=True, allowing_multiple_edges=True, weighted=False)
+    g.add_vertices_from(range(4))
+    g.create_edge(0, 1)
+    g.create_edge(1, 2)
+    g.create_edge(2, 0)
+    g.create_edge(2, 0)
+    g.create_edge(3, 3)
+    assert metrics.count_triangles(g, threads=2) == 1
+
+    with pytest.raises(ValueError):
+        metrics.count_triangles(create_graph(directed=True), threads=2)
+
+
+def test_triangle_tracker():
+    g = create_test_graph()
+    tracker = metrics.triangle_tracker(g)
+
+    assert tracker.triangles == 9
+    assert tracker.vertex_triangles(0) == 9
+    assert tracker.vertex_triangles(1) == 2
+    assert tracker.local_clustering_coefficient(0) == pytest.approx(9 / 36)
+    assert tracker.local_clustering_coefficient(1) == pytest.approx(2.0 / 3)
+
+    e = g.create_edge(1, 5)
+    assert tracker.triangles == 10
+    assert tracker.triangles == metrics.count_triangles(g)
+    assert tracker.vertex_triangles(5) == 3
+
+    g.remove_edge(e)
+    assert tracker.triangles == 9
+
+    g.remove_vertex(0)
+    assert tracker.triangles == 0
+    assert tracker.vertices_triangles() == {v: 0 for v in range(1, 10)}
+    assert tracker.global_clustering_coefficient == 0.0
+
+    g.add_vertex(10)
+    g.create_edge(1, 10)
+    g.create_edge(2, 10)
+    assert tracker.triangles == 1
+    coefficients = tracker.local_clustering_coefficients([1, 10])
+    assert coefficients[10] == pytest.approx(1.0)
+    assert coefficients[1] == pytest.approx(1.0 / 3)
+    assert tracker.global_clustering_coefficient == pytest.approx(3 / 14)
+    assert tracker.average_clustering_coefficient == pytest.approx((1 + 1.0 / 3 + 1.0 / 3) / 10)
+
+    with pytest.raises(ValueError):
+        tracker.vertex_triangles(0)
+
+    with pytest.raises(ValueError):
+        metrics.triangle_tracker(create_graph(directed=True))
+
+
+def test_triangle_tracker_views_and_generators():
+    g = create_test_graph()
+    tracker = metrics.triangle_tracker(g)
+
+    # changes through a view reach the trackers of the underlying graph
+    view = as_unweighted(g)
+    e = view.create_edge(1, 5)
+    assert tracker.triangles == 10
+    view.remove_edge(e)
+    assert tracker.triangles == 9
+
+    # and changes to the graph reach the trackers of its views
+    view_tracker = metrics.triangle_tracker(view)
+    g.create_edge(1, 5)
+    assert view_tracker.triangles == 10
+
+    # generators change the graph inside the isolate
+    generators.empty_graph(g, 2)
+    with pytest.raises(RuntimeError):
+        tracker.triangles
+    with pytest.raises(RuntimeError):
+        view_tracker.triangles
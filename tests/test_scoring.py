@@ -1,6 +1,6 @@
 import pytest
 
-from jgrapht import create_graph
+from jgrapht import create_graph, create_sparse_graph_from_arrays
 import jgrapht.algorithms.scoring as scoring
 
 def build_graph():
@@ -68,3 +68,149 @@ def test_alpha_centrality():
     result = [scores[v] for v in g.vertices()]
     expected = [1.09284015241, 1.03155950011, 1.03155950011, 1.03155950011, 1.03155950011, 1.03155950011, 1.03155950011, 1.03155950011, 1.03155950011, 1.03155950011]
     assert result == expected
+
+
+def test_scores_to_arrays():
+    g = build_graph()
+    scores = scoring.pagerank(g)
+    vertices, values = scores.to_arrays()
+    assert len(vertices) == len(values) == 10
+    assert sorted(vertices) == list(range(10))
+    assert all(scores[v] == x for v, x in zip(vertices, values))
+
+
+def test_parallel_centralities():
+    g = build_graph()
+
+    for parallelism in [1, 4, 0]:
+        scores = scoring.betweenness_centrality(g, parallelism=parallelism)
+        result = [scores[v] for v in g.vertices()]
+        assert result == pytest.approx([22.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5])
+
+        scores = scoring.closeness_centrality(g, parallelism=parallelism)
+        result = [scores[v] for v in g.vertices()]
+        assert result == [1.0, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6, 0.6]
+
+        scores = scoring.harmonic_centrality(g, parallelism=parallelism)
+        result = [scores[v] for v in g.vertices()]
+        assert result == pytest.approx([1.0] + [0.6666666666666666] * 9)
+
+
+def test_parallel_centralities_directed():
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=True, weighted=True)
+
+    for i in range(0, 6):
+        g.add_vertex(i)
+
+    g.create_edge(0, 1, weight=2.0)
+    g.create_edge(1, 2, weight=1.0)
+    g.create_edge(0, 2, weight=3.0)
+    g.create_edge(2, 3, weight=1.5)
+    g.create_edge(3, 4, weight=1.0)
+    g.create_edge(4, 0, weight=0.5)
+    g.create_edge(3, 5, weight=2.0)
+    g.create_edge(3, 5, weight=2.0)
+
+    for incoming in [False, True]:
+        for normalize in [False, True]:
+            expected = scoring.closeness_centrality(g, incoming=incoming, normalize=normalize)
+            scores = scoring.closeness_centrality(g, incoming=incoming, normalize=normalize, parallelism=2)
+            assert [scores[v] for v in g.vertices()] == pytest.approx([expected[v] for v in g.vertices()])
+
+            expected = scoring.harmonic_centrality(g, incoming=incoming, normalize=normalize)
+            scores = scoring.harmonic_centrality(g, incoming=incoming, normalize=normalize, parallelism=2)
+            assert [scores[v] for v in g.vertices()] == pytest.approx([expected[v] for v in g.vertices()])
+
+    for normalize in [False, True]:
+        expected = scoring.betweenness_centrality(g, normalize=normalize)
+        scores = scoring.betweenness_centrality(g, normalize=normalize, parallelism=3)
+        assert [scores[v] for v in g.vertices()] == pytest.approx([expected[v] for v in g.vertices()])
+
+    g.create_edge(5, 0, weight=-1.0)
+    with pytest.raises(ValueError):
+        scoring.betweenness_centrality(g, parallelism=2)
+
+
+def test_sampled_betweenness_centrality():
+    g = build_graph()
+
+    # using all vertices as pivots computes the exact scores
+    scores = scoring.betweenness_centrality(g, samples=10, seed=17)
+    result = [scores[v] for v in g.vertices()]
+    assert result == pytest.approx([22.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5])
+
+    scores1 = scoring.betweenness_centrality(g, samples=4, seed=17)
+    scores2 = scoring.betweenness_centrality(g, samples=4, seed=17, parallelism=2)
+    result1 = [scores1[v] for v in g.vertices()]
+    result2 = [scores2[v] for v in g.vertices()]
+    assert result1 == pytest.approx(result2)
+    assert sum(result1) > 0.0
+
+    scores = scoring.betweenness_centrality(g, samples=0, seed=17)
+    assert all(scores[v] == 0.0 for v in g.vertices())
+
+    with pytest.raises(ValueError):
+        scoring.betweenness_centrality(g, samples=-1)
+
+
+def test_sampled_betweenness_centrality_normalized_large():
+    # (n - 1) * (n - 2) does not fit into an int for this many vertices
+    n = 50001
+    g = create_sparse_graph_from_arrays(n, [0] * (n - 1), range(1, n), directed=False, weighted=False)
+
+    # every leaf pivot contributes n - 2 to the center, the center as pivot nothing
+    samples = 50
+    scores = scoring.betweenness_centrality(g, normalize=True, samples=samples, seed=17)
+    assert 0.5 * (samples - 1) / samples - 1e-9 <= scores[0] <= 0.5 * n / (n - 1) + 1e-9
+    assert scores[1] == 0.0
+
+
+def test_pagerank_warm_start():
+    g = build_graph()
+    scores = scoring.pagerank(g)
+    expected = [scores[v] for v in g.vertices()]
+
+    # uniform initial scores reproduce the plain computation
+    uniform = {v: 0.1 for v in g.vertices()}
+    warm = scoring.pagerank(g, initial_scores=uniform)
+    assert [warm[v] for v in g.vertices()] == pytest.approx(expected)
+
+    # starting from the result converges to the same scores
+    warm = scoring.pagerank(g, initial_scores=scores, max_iterations=2)
+    assert [warm[v] for v in g.vertices()] == pytest.approx(expected, abs=1e-4)
+
+    # uniform personalization is the plain pagerank
+    personalized = scoring.pagerank(g, personalization={v: 1.0 for v in g.vertices()})
+    assert [personalized[v] for v in g.vertices()] == pytest.approx(expected)
+
+    personalized = scoring.pagerank(g, personalization={1: 1.0})
+    assert sum(personalized[v] for v in g.vertices()) == pytest.approx(1.0)
+    assert personalized[1] > personalized[5]
+
+    with pytest.raises(ValueError):
+        scoring.pagerank(g, personalization={100: 1.0})
+
+    with pytest.raises(ValueError):
+        scoring.pagerank(g, initial_scores={1: -1.0})
+
+
+def test_pagerank_warm_start_zero_weights():
+    def build(with_zero_edge):
+        g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+        g.add_vertices_from(range(4))
+        g.create_edge(0, 1, weight=1.0)
+        g.create_edge(2, 0, weight=1.0)
+        g.create_edge(3, 0, weight=2.0)
+        g.create_edge(0, 3, weight=1.0)
+        if with_zero_edge:
+            # all out-arcs of 1 have zero weight, thus 1 is dangling
+            g.create_edge(1, 2, weight=0.0)
+        return g
+
+    uniform = {v: 0.25 for v in range(4)}
+    scores = scoring.pagerank(build(True), initial_scores=uniform)
+    dangling = scoring.pagerank(build(False), initial_scores=uniform)
+
+    result = [scores[v] for v in range(4)]
+    assert sum(result) == pytest.approx(1.0)
+    assert result == pytest.approx([dangling[v] for v in range(4)])
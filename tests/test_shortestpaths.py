@@ -3,6 +3,7 @@ import pytest
 from jgrapht import create_graph
 import jgrapht.algorithms.shortestpaths as sp
 import math
+from array import array
 
 def get_graph():
     g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
@@ -75,6 +76,105 @@ def test_dijkstra():
     assert list(single_path.edges) == [0, 1]
 
 
+def test_dijkstra_between_pairs():
+    g = get_graph()
+
+    for parallelism in [1, 3]:
+        distances = sp.dijkstra_between_pairs(g, [0, 0, 1, 5, 2], [5, 3, 5, 5, 0], parallelism=parallelism)
+        assert list(distances) == [62.0, 103.0, 102.0, 0.0, 35.0]
+
+        distances, offsets, edges = sp.dijkstra_between_pairs(
+            g, [0, 0, 1, 5, 2], [5, 3, 5, 5, 0], with_paths=True, parallelism=parallelism
+        )
+        assert list(offsets) == [0, 3, 5, 7, 7, 10]
+        assert list(edges[offsets[0]:offsets[1]]) == [2, 3, 5]
+        assert list(edges[offsets[1]:offsets[2]]) == [0, 1]
+        assert list(edges[offsets[2]:offsets[3]]) == [1, 4]
+        assert list(edges[offsets[4]:offsets[5]]) == [3, 5, 6]
+
+    g.add_vertex(6)
+    distances = sp.dijkstra_between_pairs(g, [0], [6])
+    assert math.isinf(distances[0])
+
+    with pytest.raises(ValueError):
+        sp.dijkstra_between_pairs(g, [0, 1], [2])
+
+    with pytest.raises(ValueError):
+        sp.dijkstra_between_pairs(g, [0], [100])
+
+
+def test_dijkstra_between_pairs_on_index():
+    g = get_graph()
+    index = sp.alt_index(g, landmarks=2)
+
+    for parallelism in [1, 3]:
+        distances, offsets, edges = sp.dijkstra_between_pairs(
+            index, [0, 0, 1, 5, 2], [5, 3, 5, 5, 0], with_paths=True, parallelism=parallelism
+        )
+        assert list(distances) == [62.0, 103.0, 102.0, 0.0, 35.0]
+        assert list(offsets) == [0, 3, 5, 7, 7, 10]
+        assert list(edges[offsets[0]:offsets[1]]) == [2, 3, 5]
+
+    # the snapshot of the index is reused, later vertices are unknown
+    g.add_vertex(6)
+    with pytest.raises(ValueError):
+        sp.dijkstra_between_pairs(index, [0], [6])
+
+
+def test_distance_matrix():
+    g = get_graph()
+
+    matrix = sp.distance_matrix(g, parallelism=2)
+    assert len(matrix) == 36
+    allpairs = sp.floyd_warshall_allpairs(g)
+    for u in range(6):
+        for v in range(6):
+            if u == v:
+                assert matrix[u * 6 + v] == 0.0
+            else:
+                assert matrix[u * 6 + v] == allpairs.get_path(u, v).weight
+
+    matrix = sp.distance_matrix(g, vertices=[5, 0])
+    assert list(matrix) == [0.0, 13.0, 62.0, 0.0]
+
+    out = array("d", [0.0] * 10)
+    assert sp.distance_matrix(g, vertices=[3, 1, 0], out=out) is out
+    assert list(out[:3]) == [0.0, 18.0, 15.0]
+
+    with pytest.raises(IndexError):
+        sp.distance_matrix(g, out=array("d", [0.0] * 10))
+
+
+def test_alt_index():
+    g = get_graph()
+
+    for landmarks in [1, 2, 16]:
+        index = sp.alt_index(g, landmarks=landmarks)
+
+        path = index.query(0, 5)
+        assert path.weight == 62.0
+        assert path.start_vertex == 0
+        assert path.end_vertex == 5
+        assert list(path.edges) == [2, 3, 5]
+
+        assert index.distance(0, 3) == 103.0
+        assert index.distance(2, 0) == 35.0
+        assert index.distance(3, 3) == 0.0
+        assert list(index.query(3, 3).edges) == []
+
+        distances = index.query_many([0, 0, 1], [5, 3, 5], parallelism=2)
+        assert list(distances) == [62.0, 103.0, 102.0]
+
+    # the index is a snapshot
+    g.add_vertex(6)
+    with pytest.raises(ValueError):
+        index.distance(0, 6)
+
+    index = sp.alt_index(g)
+    assert math.isinf(index.distance(0, 6))
+    assert index.query(0, 6) is None
+
+
 def test_bfs():
     g = get_graph()
 
@@ -87,6 +187,36 @@ def test_bfs():
     assert list(single_path.edges) == [7]
 
 
+def test_bfs_multisource():
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+    g.add_vertices_from(range(8))
+    for u, v in [(0, 1), (1, 2), (2, 3), (3, 4), (5, 4), (4, 6), (6, 5)]:
+        g.create_edge(u, v)
+
+    depth, parent = sp.bfs_multisource(g, [0, 5], parallelism=2)
+    assert list(depth) == [0, 1, 2, 3, 1, 0, 2, -1]
+    assert list(parent) == [-1, 0, 1, 2, 5, -1, 4, -1]
+
+    depth = sp.bfs_multisource(g, [0], max_depth=2, with_parents=False)
+    assert list(depth) == [0, 1, 2, -1, -1, -1, -1, -1]
+
+    depth, parent = sp.bfs_multisource(g, [])
+    assert list(depth) == [-1] * 8
+
+    # a larger graph which is expanded bottom-up
+    g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+    g.add_vertices_from(range(10000))
+    for v in range(1, 10000):
+        g.create_edge((v - 1) // 4, v)
+    depth, parent = sp.bfs_multisource(g, [0], parallelism=4)
+    for v in range(1, 10000):
+        assert parent[v] == (v - 1) // 4
+        assert depth[v] == depth[parent[v]] + 1
+
+    with pytest.raises(ValueError):
+        sp.bfs_multisource(g, [10000])
+
+
 def test_bellman():
     g = get_graph_with_negative_edges()
 
@@ -0,0 +1,80 @@
+import pytest
+
+from concurrent.futures import ThreadPoolExecutor
+
+from jgrapht import create_graph
+import jgrapht.algorithms.shortestpaths as sp
+import jgrapht.algorithms.scoring as scoring
+from jgrapht.io.importers import parse_gml
+
+
+def build_graph(n):
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    for i in range(0, n):
+        g.add_vertex(i)
+
+    for i in range(0, n-1):
+        g.create_edge(i, i+1, weight=2.0)
+
+    return g
+
+
+def run_dijkstra(n):
+    g = build_graph(n)
+    path = sp.dijkstra(g, 0, n-1, use_bidirectional=False)
+    return path.weight
+
+
+def run_pagerank(n):
+    g = build_graph(n)
+    scores = scoring.pagerank(g)
+    return len(scores)
+
+
+def test_backend_from_worker_threads():
+    sizes = [10, 20, 30, 40, 50, 60, 70, 80]
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        weights = list(executor.map(run_dijkstra, sizes))
+        counts = list(executor.map(run_pagerank, sizes))
+
+    assert weights == [2.0 * (n-1) for n in sizes]
+    assert counts == sizes
+
+
+def test_handles_released_in_other_thread():
+    g = build_graph(10)
+
+    def edges_count():
+        return len(list(g.edges()))
+
+    with ThreadPoolExecutor(max_workers=2) as executor:
+        results = list(executor.map(lambda _: edges_count(), range(4)))
+
+    assert results == [9, 9, 9, 9]
+
+
+def test_callbacks_from_worker_threads():
+    input_string = """graph [
+    node [ id 1 label "one" ]
+    node [ id 2 label "two" ]
+    edge [ source 1 target 2 ]
+]"""
+
+    def parse(_):
+        g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+        labels = {}
+
+        def va_cb(vertex, attribute_name, attribute_value):
+            labels[vertex] = attribute_value
+
+        parse_gml(g, input_string, vertex_attribute_cb=va_cb)
+        return len(g.vertices()), labels
+
+    with ThreadPoolExecutor(max_workers=4) as executor:
+        results = list(executor.map(parse, range(8)))
+
+    for count, labels in results:
+        assert count == 2
+        assert sorted(labels.values()) == ["one", "two"]
@@ -2,6 +2,7 @@ import pytest
 
 from jgrapht import create_graph
 import jgrapht.traversal as traversal
+from array import array
 
 
 def test_traversals():
@@ -75,3 +76,83 @@ def test_dag():
 
     
 
+
+
+def test_random_walks():
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+    g.add_vertices_from([0, 1, 2, 3, 4])
+    g.create_edge(0, 1)
+    g.create_edge(1, 2)
+    g.create_edge(2, 0)
+    g.create_edge(2, 3)
+    g.create_edge(3, 4)
+    g.set_edge_weight(2, 0.0)
+
+    walks = traversal.random_walks(g, walks_per_vertex=3, walk_length=5, weighted=True, seed=17, parallelism=2)
+    assert len(walks) == 5 * 3 * 5
+    for i in range(15):
+        walk = list(walks[i * 5:(i + 1) * 5])
+        assert walk[0] == i % 5
+        for u, v in zip(walk, walk[1:]):
+            if v == -1:
+                break
+            assert g.contains_edge_between(u, v)
+            # the edge with zero weight is never used
+            assert (u, v) != (2, 0)
+        assert walk[1:] == [-1] * 4 if walk[0] == 4 else -1 not in walk[:2]
+
+    # independent of the parallelism and the chunks
+    same = traversal.random_walks(g, walks_per_vertex=3, walk_length=5, weighted=True, seed=17)
+    assert list(same) == list(walks)
+    chunks = list(traversal.random_walks_chunks(g, walks_per_vertex=3, walk_length=5, weighted=True, seed=17, walks_per_chunk=4))
+    assert [len(c) for c in chunks] == [20, 20, 20, 15]
+    assert [v for c in chunks for v in c] == list(walks)
+
+    walks = traversal.random_walks(g, walks_per_vertex=2, walk_length=3, start_vertices=[3], p=0.5, q=2.0, seed=1)
+    assert list(walks) == [3, 4, -1, 3, 4, -1]
+
+    with pytest.raises(ValueError):
+        traversal.random_walks(g, walk_length=3, out=array("i", [0] * 5))
+    with pytest.raises(ValueError):
+        traversal.random_walks(g, p=0.0)
+
+
+def test_random_walks_lengths():
+    g = create_graph(directed=True, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+    g.add_vertices_from([-1, 0, 1])
+    g.create_edge(0, -1)
+    g.create_edge(1, 0)
+
+    # -1 is a vertex, thus only the lengths tell the padding apart
+    walks, lengths = traversal.random_walks(
+        g, walks_per_vertex=2, walk_length=3, start_vertices=[1, 0, -1], seed=5, with_lengths=True
+    )
+    assert list(walks) == [1, 0, -1, 0, -1, -1, -1, -1, -1] * 2
+    assert list(lengths) == [3, 2, 1] * 2
+
+    chunks = list(
+        traversal.random_walks_chunks(
+            g, walks_per_vertex=2, walk_length=3, start_vertices=[1, 0, -1], seed=5, walks_per_chunk=4, with_lengths=True
+        )
+    )
+    assert [list(l) for _, l in chunks] == [[3, 2, 1, 3], [2, 1]]
+    assert [v for c, _ in chunks for v in c] == list(walks)
+
+
+def test_random_walks_in_blocks(monkeypatch):
+    import jgrapht._internals._walks as walks_module
+
+    g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=False)
+    g.add_vertices_from(range(4))
+    g.create_edge(0, 1)
+    g.create_edge(1, 2)
+    g.create_edge(2, 3)
+    walks = traversal.random_walks(g, walks_per_vertex=5, walk_length=4, seed=3)
+
+    # corpora beyond the int range of a single call are written in blocks of rows
+    monkeypatch.setattr(walks_module, "_INT_MAX", 11)
+    blocks = traversal.random_walks(g, walks_per_vertex=5, walk_length=4, seed=3)
+    assert list(blocks) == list(walks)
+    blocks, lengths = traversal.random_walks(g, walks_per_vertex=5, walk_length=4, seed=3, with_lengths=True)
+    assert list(blocks) == list(walks)
+    assert list(lengths) == [4] * 20
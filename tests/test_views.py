@@ -1,7 +1,10 @@
 import pytest
 
 from jgrapht import create_graph
-from jgrapht.views import as_undirected, as_edgereversed, as_unmodifiable, as_unweighted
+from jgrapht.views import as_undirected, as_edgereversed, as_unmodifiable, as_unweighted, as_weighted
+import jgrapht.algorithms.spanning as spanning
+import jgrapht.algorithms.shortestpaths as sp
+import jgrapht.algorithms.flow as flow
 
 
 def test_as_unweighted():
@@ -121,3 +124,63 @@ def test_as_edgereversed():
     assert g4.edge_source(e45) == v5
     assert g4.edge_target(e45) == v4
 
+
+def test_as_weighted():
+    g = create_graph(directed=False, allowing_self_loops=False, allowing_multiple_edges=False, weighted=True)
+
+    g.add_vertices_from(range(4))
+    e01 = g.create_edge(0, 1, weight=1.0)
+    e12 = g.create_edge(1, 2, weight=1.0)
+    e23 = g.create_edge(2, 3, weight=1.0)
+    e03 = g.create_edge(0, 3, weight=10.0)
+
+    g1 = as_weighted(g, [5.0, 1.0, 1.0, 2.0])
+
+    assert g1.type.weighted
+    assert not g1.type.modifiable
+    assert g1.get_edge_weight(e01) == 5.0
+    assert g.get_edge_weight(e01) == 1.0
+    _, _, _, weights = g1.edge_tuples_as_arrays()
+    assert list(weights) == [5.0, 1.0, 1.0, 2.0]
+
+    weight, edges = spanning.kruskal(g1)
+    assert weight == 4.0
+    assert edges == set([e12, e23, e03])
+    assert list(sp.distance_matrix(g1, vertices=[0, 1])) == [0.0, 4.0, 4.0, 0.0]
+
+    path = sp.dijkstra(g1, 0, 3, use_bidirectional=False)
+    assert path.weight == 2.0
+    assert list(path.edges) == [e03]
+    assert sp.dijkstra(g, 0, 3).weight == 3.0
+    with pytest.raises(ValueError):
+        sp.dijkstra(g1, 0)
+    with pytest.raises(ValueError):
+        sp.dijkstra(g1, 0, 3)
+
+    # algorithms of the isolate would see the original weights
+    with pytest.raises(ValueError):
+        sp.bellman_ford(g1, 0)
+    with pytest.raises(ValueError):
+        sp.floyd_warshall_allpairs(g1)
+    with pytest.raises(ValueError):
+        sp.yen_k_loopless(g1, 0, 3, 2)
+    with pytest.raises(ValueError):
+        flow.dinic(g1, 0, 3)
+
+    # swap the weights without touching the graph
+    g1.set_weights([1.0, 1.0, 1.0, 1.0])
+    weight, edges = spanning.prim(g1)
+    assert weight == 3.0
+    assert g.get_edge_weight(e03) == 10.0
+
+    g1.set_edge_weight(e03, 0.5)
+    assert g1.get_edge_weight(e03) == 0.5
+    assert g.get_edge_weight(e03) == 10.0
+
+    # the structure follows the original graph
+    e13 = g.create_edge(1, 3)
+    assert g1.contains_edge(e13)
+    with pytest.raises(IndexError):
+        g1.get_edge_weight(e13)
+    with pytest.raises(ValueError):
+        g1.create_edge(0, 2)